@@ -2,17 +2,23 @@ library iouring_transport;
 
 export 'package:iouring_transport/transport/transport.dart' show Transport;
 
-export 'package:iouring_transport/transport/client/configuration.dart' show TransportTcpClientConfiguration, TransportUdpClientConfiguration, TransportUnixStreamClientConfiguration;
+export 'package:iouring_transport/transport/client/configuration.dart' show TransportTcpClientConfiguration, TransportUdpClientConfiguration, TransportUnixStreamClientConfiguration, TransportUnixDatagramClientConfiguration;
 export 'package:iouring_transport/transport/configuration.dart'
-    show TransportUdpMulticastConfiguration, TransportUdpMulticastManager, TransportUdpMulticastSourceConfiguration, TransportWorkerConfiguration;
-export 'package:iouring_transport/transport/server/configuration.dart' show TransportTcpServerConfiguration, TransportUdpServerConfiguration, TransportUnixStreamServerConfiguration;
+    show TransportTlsKeys, TransportUdpMulticastConfiguration, TransportUdpMulticastManager, TransportUdpMulticastSourceConfiguration, TransportWorkerConfiguration;
+export 'package:iouring_transport/transport/server/configuration.dart' show TransportTcpServerConfiguration, TransportUdpServerConfiguration, TransportUnixStreamServerConfiguration, TransportUnixDatagramServerConfiguration;
+export 'package:iouring_transport/transport/shared/configuration.dart' show TransportSharedConfiguration;
 export 'package:iouring_transport/transport/defaults.dart' show TransportDefaults;
 
 export 'package:iouring_transport/transport/worker.dart' show TransportWorker;
+export 'package:iouring_transport/transport/metrics.dart' show TransportWorkerMetrics;
+export 'package:iouring_transport/transport/latency.dart' show TransportLatencies, TransportLatencyHistogram;
+export 'package:iouring_transport/transport/trace.dart' show TransportTraceEntry, decodeTransportTrace;
+export 'package:iouring_transport/transport/messenger.dart' show TransportMessenger, TransportWorkerMessage, TransportWorkerTarget;
 
 export 'package:iouring_transport/transport/client/client.dart' show TransportClientConnectionPool;
 export 'package:iouring_transport/transport/client/factory.dart' show TransportClientsFactory;
 export 'package:iouring_transport/transport/client/provider.dart' show TransportDatagramClient, TransportClientConnection;
+export 'package:iouring_transport/transport/client/multiplexer.dart' show TransportMultiplexedClient;
 
 export 'package:iouring_transport/transport/server/factory.dart' show TransportServersFactory;
 export 'package:iouring_transport/transport/server/provider.dart' show TransportServerConnection, TransportServerDatagramReceiver;
@@ -20,5 +26,14 @@ export 'package:iouring_transport/transport/server/responder.dart' show Transpor
 
 export 'package:iouring_transport/transport/file/factory.dart' show TransportFilesFactory;
 export 'package:iouring_transport/transport/file/provider.dart' show TransportFile;
+export 'package:iouring_transport/transport/file/appender.dart' show TransportFileAppender;
+export 'package:iouring_transport/transport/file/mapped.dart' show TransportMappedFile;
+
+export 'package:iouring_transport/transport/shared/factory.dart' show TransportSharedFactory;
+export 'package:iouring_transport/transport/shared/provider.dart' show TransportSharedConnection;
 
 export 'package:iouring_transport/transport/payload.dart' show TransportPayload;
+
+export 'package:iouring_transport/transport/exception.dart' show TransportDeadlineException;
+
+export 'package:iouring_transport/transport/constants.dart' show TransportClientSelection, TransportFileAdvice, TransportOperation, TransportTlsCipher, TransportTlsVersion, TransportTraceKind;
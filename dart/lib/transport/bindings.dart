@@ -7798,6 +7798,36 @@ class TransportBindings {
   late final _transport_client_initialize_tcp =
       _transport_client_initialize_tcpPtr.asFunction<int Function(ffi.Pointer<transport_client_t>, ffi.Pointer<transport_client_configuration_t>, ffi.Pointer<ffi.Char>, int)>();
 
+  void transport_client_prepare_tcp(
+    ffi.Pointer<transport_client_t> client,
+    ffi.Pointer<transport_client_configuration_t> configuration,
+    ffi.Pointer<ffi.Char> ip,
+    int port,
+  ) {
+    return _transport_client_prepare_tcp(
+      client,
+      configuration,
+      ip,
+      port,
+    );
+  }
+
+  late final _transport_client_prepare_tcpPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_client_t>, ffi.Pointer<transport_client_configuration_t>, ffi.Pointer<ffi.Char>, ffi.Int32)>>('transport_client_prepare_tcp');
+  late final _transport_client_prepare_tcp =
+      _transport_client_prepare_tcpPtr.asFunction<void Function(ffi.Pointer<transport_client_t>, ffi.Pointer<transport_client_configuration_t>, ffi.Pointer<ffi.Char>, int)>();
+
+  int transport_client_apply_options(
+    ffi.Pointer<transport_client_t> client,
+  ) {
+    return _transport_client_apply_options(
+      client,
+    );
+  }
+
+  late final _transport_client_apply_optionsPtr = _lookup<ffi.NativeFunction<ffi.Int64 Function(ffi.Pointer<transport_client_t>)>>('transport_client_apply_options');
+  late final _transport_client_apply_options = _transport_client_apply_optionsPtr.asFunction<int Function(ffi.Pointer<transport_client_t>)>();
+
   int transport_client_initialize_udp(
     ffi.Pointer<transport_client_t> client,
     ffi.Pointer<transport_client_configuration_t> configuration,
@@ -7839,6 +7869,44 @@ class TransportBindings {
   late final _transport_client_initialize_unix_stream =
       _transport_client_initialize_unix_streamPtr.asFunction<int Function(ffi.Pointer<transport_client_t>, ffi.Pointer<transport_client_configuration_t>, ffi.Pointer<ffi.Char>)>();
 
+  int transport_client_initialize_unix_datagram(
+    ffi.Pointer<transport_client_t> client,
+    ffi.Pointer<transport_client_configuration_t> configuration,
+    ffi.Pointer<ffi.Char> destination_path,
+    ffi.Pointer<ffi.Char> source_path,
+  ) {
+    return _transport_client_initialize_unix_datagram(
+      client,
+      configuration,
+      destination_path,
+      source_path,
+    );
+  }
+
+  late final _transport_client_initialize_unix_datagramPtr =
+      _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_client_t>, ffi.Pointer<transport_client_configuration_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Char>)>>(
+          'transport_client_initialize_unix_datagram');
+  late final _transport_client_initialize_unix_datagram = _transport_client_initialize_unix_datagramPtr
+      .asFunction<int Function(ffi.Pointer<transport_client_t>, ffi.Pointer<transport_client_configuration_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Char>)>();
+
+  int transport_client_initialize_unix_seqpacket(
+    ffi.Pointer<transport_client_t> client,
+    ffi.Pointer<transport_client_configuration_t> configuration,
+    ffi.Pointer<ffi.Char> path,
+  ) {
+    return _transport_client_initialize_unix_seqpacket(
+      client,
+      configuration,
+      path,
+    );
+  }
+
+  late final _transport_client_initialize_unix_seqpacketPtr =
+      _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_client_t>, ffi.Pointer<transport_client_configuration_t>, ffi.Pointer<ffi.Char>)>>(
+          'transport_client_initialize_unix_seqpacket');
+  late final _transport_client_initialize_unix_seqpacket =
+      _transport_client_initialize_unix_seqpacketPtr.asFunction<int Function(ffi.Pointer<transport_client_t>, ffi.Pointer<transport_client_configuration_t>, ffi.Pointer<ffi.Char>)>();
+
   ffi.Pointer<sockaddr> transport_client_get_destination_address(
     ffi.Pointer<transport_client_t> client,
   ) {
@@ -9671,6 +9739,41 @@ class TransportBindings {
   late final _transport_server_initialize_unix_stream =
       _transport_server_initialize_unix_streamPtr.asFunction<int Function(ffi.Pointer<transport_server_t>, ffi.Pointer<transport_server_configuration_t>, ffi.Pointer<ffi.Char>)>();
 
+  int transport_server_initialize_unix_datagram(
+    ffi.Pointer<transport_server_t> server,
+    ffi.Pointer<transport_server_configuration_t> configuration,
+    ffi.Pointer<ffi.Char> path,
+  ) {
+    return _transport_server_initialize_unix_datagram(
+      server,
+      configuration,
+      path,
+    );
+  }
+
+  late final _transport_server_initialize_unix_datagramPtr =
+      _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_server_t>, ffi.Pointer<transport_server_configuration_t>, ffi.Pointer<ffi.Char>)>>('transport_server_initialize_unix_datagram');
+  late final _transport_server_initialize_unix_datagram =
+      _transport_server_initialize_unix_datagramPtr.asFunction<int Function(ffi.Pointer<transport_server_t>, ffi.Pointer<transport_server_configuration_t>, ffi.Pointer<ffi.Char>)>();
+
+  int transport_server_initialize_unix_seqpacket(
+    ffi.Pointer<transport_server_t> server,
+    ffi.Pointer<transport_server_configuration_t> configuration,
+    ffi.Pointer<ffi.Char> path,
+  ) {
+    return _transport_server_initialize_unix_seqpacket(
+      server,
+      configuration,
+      path,
+    );
+  }
+
+  late final _transport_server_initialize_unix_seqpacketPtr =
+      _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_server_t>, ffi.Pointer<transport_server_configuration_t>, ffi.Pointer<ffi.Char>)>>(
+          'transport_server_initialize_unix_seqpacket');
+  late final _transport_server_initialize_unix_seqpacket =
+      _transport_server_initialize_unix_seqpacketPtr.asFunction<int Function(ffi.Pointer<transport_server_t>, ffi.Pointer<transport_server_configuration_t>, ffi.Pointer<ffi.Char>)>();
+
   void transport_server_destroy(
     ffi.Pointer<transport_server_t> server,
   ) {
@@ -9719,7 +9822,7 @@ class TransportBindings {
   }
 
   late final _transport_worker_writePtr =
-      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Uint32, ffi.Int64, ffi.Uint16, ffi.Uint8)>>('transport_worker_write');
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Uint64, ffi.Int64, ffi.Uint16, ffi.Uint8)>>('transport_worker_write');
   late final _transport_worker_write = _transport_worker_writePtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int, int, int, int, int, int)>(isLeaf: true);
 
   void transport_worker_read(
@@ -9743,9 +9846,91 @@ class TransportBindings {
   }
 
   late final _transport_worker_readPtr =
-      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Uint32, ffi.Int64, ffi.Uint16, ffi.Uint8)>>('transport_worker_read');
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Uint64, ffi.Int64, ffi.Uint16, ffi.Uint8)>>('transport_worker_read');
   late final _transport_worker_read = _transport_worker_readPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int, int, int, int, int, int)>(isLeaf: true);
 
+  void transport_worker_sync(
+    ffi.Pointer<transport_worker_t> worker,
+    int fd,
+    int buffer_id,
+    bool data_only,
+    int timeout,
+    int event,
+    int sqe_flags,
+  ) {
+    return _transport_worker_sync(
+      worker,
+      fd,
+      buffer_id,
+      data_only,
+      timeout,
+      event,
+      sqe_flags,
+    );
+  }
+
+  late final _transport_worker_syncPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Bool, ffi.Int64, ffi.Uint16, ffi.Uint8)>>('transport_worker_sync');
+  late final _transport_worker_sync = _transport_worker_syncPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int, int, bool, int, int, int)>(isLeaf: true);
+
+  void transport_worker_allocate(
+    ffi.Pointer<transport_worker_t> worker,
+    int fd,
+    int buffer_id,
+    int mode,
+    int offset,
+    int length,
+    int timeout,
+    int event,
+    int sqe_flags,
+  ) {
+    return _transport_worker_allocate(
+      worker,
+      fd,
+      buffer_id,
+      mode,
+      offset,
+      length,
+      timeout,
+      event,
+      sqe_flags,
+    );
+  }
+
+  late final _transport_worker_allocatePtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Int, ffi.Uint64, ffi.Uint64, ffi.Int64, ffi.Uint16, ffi.Uint8)>>(
+          'transport_worker_allocate');
+  late final _transport_worker_allocate = _transport_worker_allocatePtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int, int, int, int, int, int, int, int)>(isLeaf: true);
+
+  void transport_worker_advise(
+    ffi.Pointer<transport_worker_t> worker,
+    int fd,
+    int buffer_id,
+    ffi.Pointer<ffi.Void> address,
+    int length,
+    int advice,
+    int timeout,
+    int event,
+    int sqe_flags,
+  ) {
+    return _transport_worker_advise(
+      worker,
+      fd,
+      buffer_id,
+      address,
+      length,
+      advice,
+      timeout,
+      event,
+      sqe_flags,
+    );
+  }
+
+  late final _transport_worker_advisePtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Pointer<ffi.Void>, ffi.Uint64, ffi.Int, ffi.Int64, ffi.Uint16, ffi.Uint8)>>(
+          'transport_worker_advise');
+  late final _transport_worker_advise = _transport_worker_advisePtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int, int, ffi.Pointer<ffi.Void>, int, int, int, int, int)>(isLeaf: true);
+
   void transport_worker_send_message(
     ffi.Pointer<transport_worker_t> worker,
     int fd,
@@ -9776,6 +9961,38 @@ class TransportBindings {
   late final _transport_worker_send_message =
       _transport_worker_send_messagePtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int, int, ffi.Pointer<sockaddr>, int, int, int, int, int)>(isLeaf: true);
 
+  void transport_worker_send_message_segmented(
+    ffi.Pointer<transport_worker_t> worker,
+    int fd,
+    int buffer_id,
+    ffi.Pointer<sockaddr> address,
+    int socket_family,
+    int message_flags,
+    int segment_size,
+    int timeout,
+    int event,
+    int sqe_flags,
+  ) {
+    return _transport_worker_send_message_segmented(
+      worker,
+      fd,
+      buffer_id,
+      address,
+      socket_family,
+      message_flags,
+      segment_size,
+      timeout,
+      event,
+      sqe_flags,
+    );
+  }
+
+  late final _transport_worker_send_message_segmentedPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Pointer<sockaddr>, ffi.Int32, ffi.Int, ffi.Uint16, ffi.Int64, ffi.Uint16, ffi.Uint8)>>(
+          'transport_worker_send_message_segmented');
+  late final _transport_worker_send_message_segmented =
+      _transport_worker_send_message_segmentedPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int, int, ffi.Pointer<sockaddr>, int, int, int, int, int, int)>(isLeaf: true);
+
   void transport_worker_receive_message(
     ffi.Pointer<transport_worker_t> worker,
     int fd,
@@ -9802,6 +10019,21 @@ class TransportBindings {
       _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Int32, ffi.Int, ffi.Int64, ffi.Uint16, ffi.Uint8)>>('transport_worker_receive_message');
   late final _transport_worker_receive_message = _transport_worker_receive_messagePtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int, int, int, int, int, int, int)>(isLeaf: true);
 
+  void transport_worker_socket(
+    ffi.Pointer<transport_worker_t> worker,
+    ffi.Pointer<transport_client_t> client,
+    int slot,
+  ) {
+    return _transport_worker_socket(
+      worker,
+      client,
+      slot,
+    );
+  }
+
+  late final _transport_worker_socketPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_client_t>, ffi.Uint32)>>('transport_worker_socket');
+  late final _transport_worker_socket = _transport_worker_socketPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_client_t>, int)>(isLeaf: true);
+
   void transport_worker_connect(
     ffi.Pointer<transport_worker_t> worker,
     ffi.Pointer<transport_client_t> client,
@@ -9817,6 +10049,25 @@ class TransportBindings {
   late final _transport_worker_connectPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_client_t>, ffi.Int64)>>('transport_worker_connect');
   late final _transport_worker_connect = _transport_worker_connectPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_client_t>, int)>(isLeaf: true);
 
+  void transport_worker_connect_with_data(
+    ffi.Pointer<transport_worker_t> worker,
+    ffi.Pointer<transport_client_t> client,
+    int buffer_id,
+    int timeout,
+  ) {
+    return _transport_worker_connect_with_data(
+      worker,
+      client,
+      buffer_id,
+      timeout,
+    );
+  }
+
+  late final _transport_worker_connect_with_dataPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_client_t>, ffi.Uint16, ffi.Int64)>>('transport_worker_connect_with_data');
+  late final _transport_worker_connect_with_data =
+      _transport_worker_connect_with_dataPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_client_t>, int, int)>(isLeaf: true);
+
   void transport_worker_accept(
     ffi.Pointer<transport_worker_t> worker,
     ffi.Pointer<transport_server_t> server,
@@ -9830,6 +10081,51 @@ class TransportBindings {
   late final _transport_worker_acceptPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_server_t>)>>('transport_worker_accept');
   late final _transport_worker_accept = _transport_worker_acceptPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_server_t>)>(isLeaf: true);
 
+  void transport_worker_send_ring_message(
+    ffi.Pointer<transport_worker_t> worker,
+    ffi.Pointer<transport_worker_t> target,
+    int data,
+    int value,
+    int event,
+  ) {
+    return _transport_worker_send_ring_message(
+      worker,
+      target,
+      data,
+      value,
+      event,
+    );
+  }
+
+  late final _transport_worker_send_ring_messagePtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Int32, ffi.Uint16)>>('transport_worker_send_ring_message');
+  late final _transport_worker_send_ring_message =
+      _transport_worker_send_ring_messagePtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_worker_t>, int, int, int)>(isLeaf: true);
+
+  void transport_worker_wait(
+    ffi.Pointer<transport_worker_t> worker,
+    int fd,
+    int buffer_id,
+    ffi.Pointer<ffi.Uint32> address,
+    int value,
+    int timeout,
+    int event,
+  ) {
+    return _transport_worker_wait(
+      worker,
+      fd,
+      buffer_id,
+      address,
+      value,
+      timeout,
+      event,
+    );
+  }
+
+  late final _transport_worker_waitPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Pointer<ffi.Uint32>, ffi.Uint32, ffi.Int64, ffi.Uint16)>>('transport_worker_wait');
+  late final _transport_worker_wait = _transport_worker_waitPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int, int, ffi.Pointer<ffi.Uint32>, int, int, int)>(isLeaf: true);
+
   void transport_worker_cancel_by_fd(
     ffi.Pointer<transport_worker_t> worker,
     int fd,
@@ -9854,18 +10150,48 @@ class TransportBindings {
   late final _transport_worker_check_event_timeoutsPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>)>>('transport_worker_check_event_timeouts');
   late final _transport_worker_check_event_timeouts = _transport_worker_check_event_timeoutsPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>)>(isLeaf: true);
 
-  void transport_worker_remove_event(
+  int transport_worker_remove_event(
     ffi.Pointer<transport_worker_t> worker,
-    int data,
+    int user_data,
   ) {
     return _transport_worker_remove_event(
       worker,
-      data,
+      user_data,
+    );
+  }
+
+  late final _transport_worker_remove_eventPtr = _lookup<ffi.NativeFunction<ffi.Uint64 Function(ffi.Pointer<transport_worker_t>, ffi.Uint64)>>('transport_worker_remove_event');
+  late final _transport_worker_remove_event = _transport_worker_remove_eventPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>, int)>(isLeaf: true);
+
+  int transport_worker_bind(
+    ffi.Pointer<transport_worker_t> worker,
+    int fd,
+    int handle,
+  ) {
+    return _transport_worker_bind(
+      worker,
+      fd,
+      handle,
+    );
+  }
+
+  late final _transport_worker_bindPtr = _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32)>>('transport_worker_bind');
+  late final _transport_worker_bind = _transport_worker_bindPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>, int, int)>(isLeaf: true);
+
+  bool transport_worker_unbind(
+    ffi.Pointer<transport_worker_t> worker,
+    int fd,
+    int handle,
+  ) {
+    return _transport_worker_unbind(
+      worker,
+      fd,
+      handle,
     );
   }
 
-  late final _transport_worker_remove_eventPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint64)>>('transport_worker_remove_event');
-  late final _transport_worker_remove_event = _transport_worker_remove_eventPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int)>(isLeaf: true);
+  late final _transport_worker_unbindPtr = _lookup<ffi.NativeFunction<ffi.Bool Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32)>>('transport_worker_unbind');
+  late final _transport_worker_unbind = _transport_worker_unbindPtr.asFunction<bool Function(ffi.Pointer<transport_worker_t>, int, int)>(isLeaf: true);
 
   int transport_worker_get_buffer(
     ffi.Pointer<transport_worker_t> worker,
@@ -9891,6 +10217,32 @@ class TransportBindings {
   late final _transport_worker_release_bufferPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint16)>>('transport_worker_release_buffer');
   late final _transport_worker_release_buffer = _transport_worker_release_bufferPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int)>(isLeaf: true);
 
+  int transport_worker_grow_buffers(
+    ffi.Pointer<transport_worker_t> worker,
+    int count,
+  ) {
+    return _transport_worker_grow_buffers(
+      worker,
+      count,
+    );
+  }
+
+  late final _transport_worker_grow_buffersPtr = _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint16)>>('transport_worker_grow_buffers');
+  late final _transport_worker_grow_buffers = _transport_worker_grow_buffersPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>, int)>(isLeaf: true);
+
+  int transport_worker_shrink_buffers(
+    ffi.Pointer<transport_worker_t> worker,
+    int count,
+  ) {
+    return _transport_worker_shrink_buffers(
+      worker,
+      count,
+    );
+  }
+
+  late final _transport_worker_shrink_buffersPtr = _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint16)>>('transport_worker_shrink_buffers');
+  late final _transport_worker_shrink_buffers = _transport_worker_shrink_buffersPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>, int)>(isLeaf: true);
+
   int transport_worker_available_buffers(
     ffi.Pointer<transport_worker_t> worker,
   ) {
@@ -9925,48 +10277,365 @@ class TransportBindings {
     );
   }
 
-  late final _transport_worker_get_datagram_addressPtr =
-      _lookup<ffi.NativeFunction<ffi.Pointer<sockaddr> Function(ffi.Pointer<transport_worker_t>, ffi.Int32, ffi.Int)>>('transport_worker_get_datagram_address');
-  late final _transport_worker_get_datagram_address = _transport_worker_get_datagram_addressPtr.asFunction<ffi.Pointer<sockaddr> Function(ffi.Pointer<transport_worker_t>, int, int)>(isLeaf: true);
+  late final _transport_worker_get_datagram_addressPtr =
+      _lookup<ffi.NativeFunction<ffi.Pointer<sockaddr> Function(ffi.Pointer<transport_worker_t>, ffi.Int32, ffi.Int)>>('transport_worker_get_datagram_address');
+  late final _transport_worker_get_datagram_address = _transport_worker_get_datagram_addressPtr.asFunction<ffi.Pointer<sockaddr> Function(ffi.Pointer<transport_worker_t>, int, int)>(isLeaf: true);
+
+  int transport_worker_get_datagram_segment_size(
+    ffi.Pointer<transport_worker_t> worker,
+    int socket_family,
+    int buffer_id,
+  ) {
+    return _transport_worker_get_datagram_segment_size(
+      worker,
+      socket_family,
+      buffer_id,
+    );
+  }
+
+  late final _transport_worker_get_datagram_segment_sizePtr =
+      _lookup<ffi.NativeFunction<ffi.Uint16 Function(ffi.Pointer<transport_worker_t>, ffi.Int32, ffi.Int)>>('transport_worker_get_datagram_segment_size');
+  late final _transport_worker_get_datagram_segment_size = _transport_worker_get_datagram_segment_sizePtr.asFunction<int Function(ffi.Pointer<transport_worker_t>, int, int)>(isLeaf: true);
+
+  int transport_worker_get_datagram_timestamp(
+    ffi.Pointer<transport_worker_t> worker,
+    int socket_family,
+    int buffer_id,
+  ) {
+    return _transport_worker_get_datagram_timestamp(
+      worker,
+      socket_family,
+      buffer_id,
+    );
+  }
+
+  late final _transport_worker_get_datagram_timestampPtr =
+      _lookup<ffi.NativeFunction<ffi.Uint64 Function(ffi.Pointer<transport_worker_t>, ffi.Int32, ffi.Int)>>('transport_worker_get_datagram_timestamp');
+  late final _transport_worker_get_datagram_timestamp = _transport_worker_get_datagram_timestampPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>, int, int)>(isLeaf: true);
+
+  int transport_worker_peek(
+    ffi.Pointer<transport_worker_t> worker,
+  ) {
+    return _transport_worker_peek(
+      worker,
+    );
+  }
+
+  late final _transport_worker_peekPtr = _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_worker_t>)>>('transport_worker_peek');
+  late final _transport_worker_peek = _transport_worker_peekPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>)>(isLeaf: true);
+
+  void transport_worker_snapshot_latencies(
+    ffi.Pointer<transport_worker_t> worker,
+    ffi.Pointer<transport_histogram_t> target,
+    bool reset,
+  ) {
+    return _transport_worker_snapshot_latencies(
+      worker,
+      target,
+      reset,
+    );
+  }
+
+  late final _transport_worker_snapshot_latenciesPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_histogram_t>, ffi.Bool)>>('transport_worker_snapshot_latencies');
+  late final _transport_worker_snapshot_latencies =
+      _transport_worker_snapshot_latenciesPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_histogram_t>, bool)>(isLeaf: true);
+
+  int transport_worker_dump_trace(
+    ffi.Pointer<transport_worker_t> worker,
+    ffi.Pointer<transport_trace_entry_t> target,
+    int capacity,
+  ) {
+    return _transport_worker_dump_trace(
+      worker,
+      target,
+      capacity,
+    );
+  }
+
+  late final _transport_worker_dump_tracePtr =
+      _lookup<ffi.NativeFunction<ffi.Size Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_trace_entry_t>, ffi.Size)>>('transport_worker_dump_trace');
+  late final _transport_worker_dump_trace = _transport_worker_dump_tracePtr.asFunction<int Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_trace_entry_t>, int)>(isLeaf: true);
+
+  void transport_worker_destroy(
+    ffi.Pointer<transport_worker_t> worker,
+  ) {
+    return _transport_worker_destroy(
+      worker,
+    );
+  }
+
+  late final _transport_worker_destroyPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>)>>('transport_worker_destroy');
+  late final _transport_worker_destroy = _transport_worker_destroyPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>)>(isLeaf: true);
+
+  int transport_file_open(
+    ffi.Pointer<ffi.Char> path,
+    int mode,
+    bool truncate,
+    bool create,
+  ) {
+    return _transport_file_open(
+      path,
+      mode,
+      truncate,
+      create,
+    );
+  }
+
+  late final _transport_file_openPtr = _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<ffi.Char>, ffi.Int, ffi.Bool, ffi.Bool)>>('transport_file_open');
+  late final _transport_file_open = _transport_file_openPtr.asFunction<int Function(ffi.Pointer<ffi.Char>, int, bool, bool)>();
+
+  ffi.Pointer<ffi.Void> transport_file_map(
+    int fd,
+    int size,
+  ) {
+    return _transport_file_map(
+      fd,
+      size,
+    );
+  }
+
+  late final _transport_file_mapPtr = _lookup<ffi.NativeFunction<ffi.Pointer<ffi.Void> Function(ffi.Int, ffi.Size)>>('transport_file_map');
+  late final _transport_file_map = _transport_file_mapPtr.asFunction<ffi.Pointer<ffi.Void> Function(int, int)>();
+
+  int transport_file_unmap(
+    ffi.Pointer<ffi.Void> address,
+    int size,
+  ) {
+    return _transport_file_unmap(
+      address,
+      size,
+    );
+  }
+
+  late final _transport_file_unmapPtr = _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<ffi.Void>, ffi.Size)>>('transport_file_unmap');
+  late final _transport_file_unmap = _transport_file_unmapPtr.asFunction<int Function(ffi.Pointer<ffi.Void>, int)>();
+
+  int transport_file_advise(
+    ffi.Pointer<ffi.Void> address,
+    int size,
+    int advice,
+  ) {
+    return _transport_file_advise(
+      address,
+      size,
+      advice,
+    );
+  }
+
+  late final _transport_file_advisePtr = _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<ffi.Void>, ffi.Size, ffi.Int)>>('transport_file_advise');
+  late final _transport_file_advise = _transport_file_advisePtr.asFunction<int Function(ffi.Pointer<ffi.Void>, int, int)>();
+
+  int transport_shared_connect(
+    ffi.Pointer<ffi.Char> path,
+  ) {
+    return _transport_shared_connect(
+      path,
+    );
+  }
+
+  late final _transport_shared_connectPtr = _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<ffi.Char>)>>('transport_shared_connect');
+  late final _transport_shared_connect = _transport_shared_connectPtr.asFunction<int Function(ffi.Pointer<ffi.Char>)>();
+
+  int transport_shared_create(
+    ffi.Pointer<transport_shared_t> shared,
+    int fd,
+    int capacity,
+  ) {
+    return _transport_shared_create(
+      shared,
+      fd,
+      capacity,
+    );
+  }
+
+  late final _transport_shared_createPtr = _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_shared_t>, ffi.Int, ffi.Uint32)>>('transport_shared_create');
+  late final _transport_shared_create = _transport_shared_createPtr.asFunction<int Function(ffi.Pointer<transport_shared_t>, int, int)>();
+
+  int transport_shared_send(
+    ffi.Pointer<transport_shared_t> shared,
+  ) {
+    return _transport_shared_send(
+      shared,
+    );
+  }
+
+  late final _transport_shared_sendPtr = _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_shared_t>)>>('transport_shared_send');
+  late final _transport_shared_send = _transport_shared_sendPtr.asFunction<int Function(ffi.Pointer<transport_shared_t>)>();
+
+  void transport_shared_receive(
+    ffi.Pointer<transport_shared_t> shared,
+    ffi.Pointer<transport_worker_t> worker,
+    int fd,
+    int buffer_id,
+    int timeout,
+  ) {
+    return _transport_shared_receive(
+      shared,
+      worker,
+      fd,
+      buffer_id,
+      timeout,
+    );
+  }
+
+  late final _transport_shared_receivePtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_shared_t>, ffi.Pointer<transport_worker_t>, ffi.Int, ffi.Uint16, ffi.Int64)>>('transport_shared_receive');
+  late final _transport_shared_receive = _transport_shared_receivePtr.asFunction<void Function(ffi.Pointer<transport_shared_t>, ffi.Pointer<transport_worker_t>, int, int, int)>(isLeaf: true);
+
+  int transport_shared_attach(
+    ffi.Pointer<transport_shared_t> shared,
+    ffi.Pointer<transport_worker_t> worker,
+    int buffer_id,
+  ) {
+    return _transport_shared_attach(
+      shared,
+      worker,
+      buffer_id,
+    );
+  }
+
+  late final _transport_shared_attachPtr = _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_shared_t>, ffi.Pointer<transport_worker_t>, ffi.Uint16)>>('transport_shared_attach');
+  late final _transport_shared_attach = _transport_shared_attachPtr.asFunction<int Function(ffi.Pointer<transport_shared_t>, ffi.Pointer<transport_worker_t>, int)>();
+
+  int transport_shared_read(
+    ffi.Pointer<transport_shared_t> shared,
+    ffi.Pointer<transport_worker_t> worker,
+    int buffer_id,
+  ) {
+    return _transport_shared_read(
+      shared,
+      worker,
+      buffer_id,
+    );
+  }
+
+  late final _transport_shared_readPtr = _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_shared_t>, ffi.Pointer<transport_worker_t>, ffi.Uint16)>>('transport_shared_read');
+  late final _transport_shared_read = _transport_shared_readPtr.asFunction<int Function(ffi.Pointer<transport_shared_t>, ffi.Pointer<transport_worker_t>, int)>(isLeaf: true);
+
+  int transport_shared_write(
+    ffi.Pointer<transport_shared_t> shared,
+    ffi.Pointer<transport_worker_t> worker,
+    int buffer_id,
+  ) {
+    return _transport_shared_write(
+      shared,
+      worker,
+      buffer_id,
+    );
+  }
+
+  late final _transport_shared_writePtr = _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_shared_t>, ffi.Pointer<transport_worker_t>, ffi.Uint16)>>('transport_shared_write');
+  late final _transport_shared_write = _transport_shared_writePtr.asFunction<int Function(ffi.Pointer<transport_shared_t>, ffi.Pointer<transport_worker_t>, int)>(isLeaf: true);
+
+  bool transport_shared_wait_readable(
+    ffi.Pointer<transport_shared_t> shared,
+    ffi.Pointer<transport_worker_t> worker,
+    int buffer_id,
+    int timeout,
+  ) {
+    return _transport_shared_wait_readable(
+      shared,
+      worker,
+      buffer_id,
+      timeout,
+    );
+  }
+
+  late final _transport_shared_wait_readablePtr =
+      _lookup<ffi.NativeFunction<ffi.Bool Function(ffi.Pointer<transport_shared_t>, ffi.Pointer<transport_worker_t>, ffi.Uint16, ffi.Int64)>>('transport_shared_wait_readable');
+  late final _transport_shared_wait_readable = _transport_shared_wait_readablePtr.asFunction<bool Function(ffi.Pointer<transport_shared_t>, ffi.Pointer<transport_worker_t>, int, int)>(isLeaf: true);
+
+  bool transport_shared_wait_writable(
+    ffi.Pointer<transport_shared_t> shared,
+    ffi.Pointer<transport_worker_t> worker,
+    int buffer_id,
+    int timeout,
+  ) {
+    return _transport_shared_wait_writable(
+      shared,
+      worker,
+      buffer_id,
+      timeout,
+    );
+  }
+
+  late final _transport_shared_wait_writablePtr =
+      _lookup<ffi.NativeFunction<ffi.Bool Function(ffi.Pointer<transport_shared_t>, ffi.Pointer<transport_worker_t>, ffi.Uint16, ffi.Int64)>>('transport_shared_wait_writable');
+  late final _transport_shared_wait_writable = _transport_shared_wait_writablePtr.asFunction<bool Function(ffi.Pointer<transport_shared_t>, ffi.Pointer<transport_worker_t>, int, int)>(isLeaf: true);
+
+  void transport_shared_destroy(
+    ffi.Pointer<transport_shared_t> shared,
+  ) {
+    return _transport_shared_destroy(
+      shared,
+    );
+  }
+
+  late final _transport_shared_destroyPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_shared_t>)>>('transport_shared_destroy');
+  late final _transport_shared_destroy = _transport_shared_destroyPtr.asFunction<void Function(ffi.Pointer<transport_shared_t>)>();
 
-  int transport_worker_peek(
-    ffi.Pointer<transport_worker_t> worker,
+  int transport_socket_collect_tcp_options(
+    ffi.Pointer<transport_socket_option_t> options,
+    int flags,
+    int socket_receive_buffer_size,
+    int socket_send_buffer_size,
+    int socket_receive_low_at,
+    int socket_send_low_at,
+    int ip_ttl,
+    int tcp_keep_alive_idle,
+    int tcp_keep_alive_max_count,
+    int tcp_keep_alive_individual_count,
+    int tcp_max_segment_size,
+    int tcp_syn_count,
   ) {
-    return _transport_worker_peek(
-      worker,
+    return _transport_socket_collect_tcp_options(
+      options,
+      flags,
+      socket_receive_buffer_size,
+      socket_send_buffer_size,
+      socket_receive_low_at,
+      socket_send_low_at,
+      ip_ttl,
+      tcp_keep_alive_idle,
+      tcp_keep_alive_max_count,
+      tcp_keep_alive_individual_count,
+      tcp_max_segment_size,
+      tcp_syn_count,
     );
   }
 
-  late final _transport_worker_peekPtr = _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_worker_t>)>>('transport_worker_peek');
-  late final _transport_worker_peek = _transport_worker_peekPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>)>(isLeaf: true);
+  late final _transport_socket_collect_tcp_optionsPtr =
+      _lookup<ffi.NativeFunction<ffi.Uint32 Function(ffi.Pointer<transport_socket_option_t>, ffi.Uint64, ffi.Uint32, ffi.Uint32, ffi.Uint32, ffi.Uint32, ffi.Uint16, ffi.Uint32, ffi.Uint32, ffi.Uint32, ffi.Uint32, ffi.Uint16)>>(
+          'transport_socket_collect_tcp_options');
+  late final _transport_socket_collect_tcp_options =
+      _transport_socket_collect_tcp_optionsPtr.asFunction<int Function(ffi.Pointer<transport_socket_option_t>, int, int, int, int, int, int, int, int, int, int, int)>();
 
-  void transport_worker_destroy(
-    ffi.Pointer<transport_worker_t> worker,
+  int transport_socket_apply_options(
+    int fd,
+    ffi.Pointer<transport_socket_option_t> options,
+    int count,
   ) {
-    return _transport_worker_destroy(
-      worker,
+    return _transport_socket_apply_options(
+      fd,
+      options,
+      count,
     );
   }
 
-  late final _transport_worker_destroyPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>)>>('transport_worker_destroy');
-  late final _transport_worker_destroy = _transport_worker_destroyPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>)>(isLeaf: true);
+  late final _transport_socket_apply_optionsPtr = _lookup<ffi.NativeFunction<ffi.Int64 Function(ffi.Int, ffi.Pointer<transport_socket_option_t>, ffi.Uint32)>>('transport_socket_apply_options');
+  late final _transport_socket_apply_options = _transport_socket_apply_optionsPtr.asFunction<int Function(int, ffi.Pointer<transport_socket_option_t>, int)>();
 
-  int transport_file_open(
-    ffi.Pointer<ffi.Char> path,
-    int mode,
-    bool truncate,
-    bool create,
+  int transport_socket_tcp_type(
+    int flags,
   ) {
-    return _transport_file_open(
-      path,
-      mode,
-      truncate,
-      create,
+    return _transport_socket_tcp_type(
+      flags,
     );
   }
 
-  late final _transport_file_openPtr = _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<ffi.Char>, ffi.Int, ffi.Bool, ffi.Bool)>>('transport_file_open');
-  late final _transport_file_open = _transport_file_openPtr.asFunction<int Function(ffi.Pointer<ffi.Char>, int, bool, bool)>();
+  late final _transport_socket_tcp_typePtr = _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Uint64)>>('transport_socket_tcp_type');
+  late final _transport_socket_tcp_type = _transport_socket_tcp_typePtr.asFunction<int Function(int)>();
 
   int transport_socket_create_tcp(
     int flags,
@@ -10151,6 +10820,51 @@ class TransportBindings {
   late final _transport_socket_get_interface_indexPtr = _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<ffi.Char>)>>('transport_socket_get_interface_index');
   late final _transport_socket_get_interface_index = _transport_socket_get_interface_indexPtr.asFunction<int Function(ffi.Pointer<ffi.Char>)>();
 
+  int transport_socket_enable_tls(
+    int fd,
+  ) {
+    return _transport_socket_enable_tls(
+      fd,
+    );
+  }
+
+  late final _transport_socket_enable_tlsPtr = _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Int)>>('transport_socket_enable_tls');
+  late final _transport_socket_enable_tls = _transport_socket_enable_tlsPtr.asFunction<int Function(int)>();
+
+  int transport_socket_set_tls_keys(
+    int fd,
+    bool receive,
+    int version,
+    int cipher,
+    ffi.Pointer<ffi.Uint8> key,
+    int key_length,
+    ffi.Pointer<ffi.Uint8> iv,
+    int iv_length,
+    ffi.Pointer<ffi.Uint8> salt,
+    int salt_length,
+    ffi.Pointer<ffi.Uint8> sequence,
+  ) {
+    return _transport_socket_set_tls_keys(
+      fd,
+      receive,
+      version,
+      cipher,
+      key,
+      key_length,
+      iv,
+      iv_length,
+      salt,
+      salt_length,
+      sequence,
+    );
+  }
+
+  late final _transport_socket_set_tls_keysPtr =
+      _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Int, ffi.Bool, ffi.Uint16, ffi.Uint16, ffi.Pointer<ffi.Uint8>, ffi.Size, ffi.Pointer<ffi.Uint8>, ffi.Size, ffi.Pointer<ffi.Uint8>, ffi.Size, ffi.Pointer<ffi.Uint8>)>>(
+          'transport_socket_set_tls_keys');
+  late final _transport_socket_set_tls_keys =
+      _transport_socket_set_tls_keysPtr.asFunction<int Function(int, bool, int, int, ffi.Pointer<ffi.Uint8>, int, ffi.Pointer<ffi.Uint8>, int, ffi.Pointer<ffi.Uint8>, int, ffi.Pointer<ffi.Uint8>)>();
+
   late final addresses = _SymbolAddresses(this);
 }
 
@@ -10775,10 +11489,17 @@ class _SymbolAddresses {
   ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Int, ffi.Pointer<timeval>)>> get futimes => _library._futimesPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_client_t>, ffi.Pointer<transport_client_configuration_t>, ffi.Pointer<ffi.Char>, ffi.Int32)>>
       get transport_client_initialize_tcp => _library._transport_client_initialize_tcpPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_client_t>, ffi.Pointer<transport_client_configuration_t>, ffi.Pointer<ffi.Char>, ffi.Int32)>>
+      get transport_client_prepare_tcp => _library._transport_client_prepare_tcpPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int64 Function(ffi.Pointer<transport_client_t>)>> get transport_client_apply_options => _library._transport_client_apply_optionsPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_client_t>, ffi.Pointer<transport_client_configuration_t>, ffi.Pointer<ffi.Char>, ffi.Int32, ffi.Pointer<ffi.Char>, ffi.Int32)>>
       get transport_client_initialize_udp => _library._transport_client_initialize_udpPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_client_t>, ffi.Pointer<transport_client_configuration_t>, ffi.Pointer<ffi.Char>)>>
       get transport_client_initialize_unix_stream => _library._transport_client_initialize_unix_streamPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_client_t>, ffi.Pointer<transport_client_configuration_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Char>)>>
+      get transport_client_initialize_unix_datagram => _library._transport_client_initialize_unix_datagramPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_client_t>, ffi.Pointer<transport_client_configuration_t>, ffi.Pointer<ffi.Char>)>>
+      get transport_client_initialize_unix_seqpacket => _library._transport_client_initialize_unix_seqpacketPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Pointer<sockaddr> Function(ffi.Pointer<transport_client_t>)>> get transport_client_get_destination_address =>
       _library._transport_client_get_destination_addressPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_client_t>)>> get transport_client_destroy => _library._transport_client_destroyPtr;
@@ -10938,31 +11659,82 @@ class _SymbolAddresses {
       get transport_server_initialize_udp => _library._transport_server_initialize_udpPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_server_t>, ffi.Pointer<transport_server_configuration_t>, ffi.Pointer<ffi.Char>)>>
       get transport_server_initialize_unix_stream => _library._transport_server_initialize_unix_streamPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_server_t>, ffi.Pointer<transport_server_configuration_t>, ffi.Pointer<ffi.Char>)>>
+      get transport_server_initialize_unix_datagram => _library._transport_server_initialize_unix_datagramPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_server_t>, ffi.Pointer<transport_server_configuration_t>, ffi.Pointer<ffi.Char>)>>
+      get transport_server_initialize_unix_seqpacket => _library._transport_server_initialize_unix_seqpacketPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_server_t>)>> get transport_server_destroy => _library._transport_server_destroyPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_worker_configuration_t>, ffi.Uint8)>> get transport_worker_initialize =>
       _library._transport_worker_initializePtr;
-  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Uint32, ffi.Int64, ffi.Uint16, ffi.Uint8)>> get transport_worker_write =>
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Uint64, ffi.Int64, ffi.Uint16, ffi.Uint8)>> get transport_worker_write =>
       _library._transport_worker_writePtr;
-  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Uint32, ffi.Int64, ffi.Uint16, ffi.Uint8)>> get transport_worker_read =>
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Uint64, ffi.Int64, ffi.Uint16, ffi.Uint8)>> get transport_worker_read =>
       _library._transport_worker_readPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Bool, ffi.Int64, ffi.Uint16, ffi.Uint8)>> get transport_worker_sync =>
+      _library._transport_worker_syncPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Int, ffi.Uint64, ffi.Uint64, ffi.Int64, ffi.Uint16, ffi.Uint8)>>
+      get transport_worker_allocate => _library._transport_worker_allocatePtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Pointer<ffi.Void>, ffi.Uint64, ffi.Int, ffi.Int64, ffi.Uint16, ffi.Uint8)>>
+      get transport_worker_advise => _library._transport_worker_advisePtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Pointer<sockaddr>, ffi.Int32, ffi.Int, ffi.Int64, ffi.Uint16, ffi.Uint8)>>
       get transport_worker_send_message => _library._transport_worker_send_messagePtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Pointer<sockaddr>, ffi.Int32, ffi.Int, ffi.Uint16, ffi.Int64, ffi.Uint16, ffi.Uint8)>>
+      get transport_worker_send_message_segmented => _library._transport_worker_send_message_segmentedPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Int32, ffi.Int, ffi.Int64, ffi.Uint16, ffi.Uint8)>>
       get transport_worker_receive_message => _library._transport_worker_receive_messagePtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_client_t>, ffi.Uint32)>> get transport_worker_socket => _library._transport_worker_socketPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_client_t>, ffi.Int64)>> get transport_worker_connect => _library._transport_worker_connectPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_client_t>, ffi.Uint16, ffi.Int64)>> get transport_worker_connect_with_data =>
+      _library._transport_worker_connect_with_dataPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_server_t>)>> get transport_worker_accept => _library._transport_worker_acceptPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Int32, ffi.Uint16)>> get transport_worker_send_ring_message =>
+      _library._transport_worker_send_ring_messagePtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Pointer<ffi.Uint32>, ffi.Uint32, ffi.Int64, ffi.Uint16)>> get transport_worker_wait =>
+      _library._transport_worker_waitPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Int)>> get transport_worker_cancel_by_fd => _library._transport_worker_cancel_by_fdPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>)>> get transport_worker_check_event_timeouts => _library._transport_worker_check_event_timeoutsPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint64)>> get transport_worker_remove_event => _library._transport_worker_remove_eventPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32)>> get transport_worker_bind => _library._transport_worker_bindPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Bool Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32)>> get transport_worker_unbind => _library._transport_worker_unbindPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>)>> get transport_worker_get_buffer => _library._transport_worker_get_bufferPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint16)>> get transport_worker_release_buffer => _library._transport_worker_release_bufferPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint16)>> get transport_worker_grow_buffers => _library._transport_worker_grow_buffersPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint16)>> get transport_worker_shrink_buffers => _library._transport_worker_shrink_buffersPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>)>> get transport_worker_available_buffers => _library._transport_worker_available_buffersPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>)>> get transport_worker_used_buffers => _library._transport_worker_used_buffersPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Pointer<sockaddr> Function(ffi.Pointer<transport_worker_t>, ffi.Int32, ffi.Int)>> get transport_worker_get_datagram_address =>
       _library._transport_worker_get_datagram_addressPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Uint16 Function(ffi.Pointer<transport_worker_t>, ffi.Int32, ffi.Int)>> get transport_worker_get_datagram_segment_size =>
+      _library._transport_worker_get_datagram_segment_sizePtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Uint64 Function(ffi.Pointer<transport_worker_t>, ffi.Int32, ffi.Int)>> get transport_worker_get_datagram_timestamp =>
+      _library._transport_worker_get_datagram_timestampPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_worker_t>)>> get transport_worker_peek => _library._transport_worker_peekPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_histogram_t>, ffi.Bool)>> get transport_worker_snapshot_latencies =>
+      _library._transport_worker_snapshot_latenciesPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Size Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_trace_entry_t>, ffi.Size)>> get transport_worker_dump_trace =>
+      _library._transport_worker_dump_tracePtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>)>> get transport_worker_destroy => _library._transport_worker_destroyPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<ffi.Char>, ffi.Int, ffi.Bool, ffi.Bool)>> get transport_file_open => _library._transport_file_openPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Pointer<ffi.Void> Function(ffi.Int, ffi.Size)>> get transport_file_map => _library._transport_file_mapPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<ffi.Void>, ffi.Size)>> get transport_file_unmap => _library._transport_file_unmapPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<ffi.Void>, ffi.Size, ffi.Int)>> get transport_file_advise => _library._transport_file_advisePtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<ffi.Char>)>> get transport_shared_connect => _library._transport_shared_connectPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_shared_t>, ffi.Int, ffi.Uint32)>> get transport_shared_create => _library._transport_shared_createPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_shared_t>)>> get transport_shared_send => _library._transport_shared_sendPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_shared_t>, ffi.Pointer<transport_worker_t>, ffi.Int, ffi.Uint16, ffi.Int64)>> get transport_shared_receive =>
+      _library._transport_shared_receivePtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_shared_t>, ffi.Pointer<transport_worker_t>, ffi.Uint16)>> get transport_shared_attach => _library._transport_shared_attachPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_shared_t>, ffi.Pointer<transport_worker_t>, ffi.Uint16)>> get transport_shared_read => _library._transport_shared_readPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_shared_t>, ffi.Pointer<transport_worker_t>, ffi.Uint16)>> get transport_shared_write => _library._transport_shared_writePtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Bool Function(ffi.Pointer<transport_shared_t>, ffi.Pointer<transport_worker_t>, ffi.Uint16, ffi.Int64)>> get transport_shared_wait_readable =>
+      _library._transport_shared_wait_readablePtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Bool Function(ffi.Pointer<transport_shared_t>, ffi.Pointer<transport_worker_t>, ffi.Uint16, ffi.Int64)>> get transport_shared_wait_writable =>
+      _library._transport_shared_wait_writablePtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_shared_t>)>> get transport_shared_destroy => _library._transport_shared_destroyPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Uint32 Function(ffi.Pointer<transport_socket_option_t>, ffi.Uint64, ffi.Uint32, ffi.Uint32, ffi.Uint32, ffi.Uint32, ffi.Uint16, ffi.Uint32, ffi.Uint32, ffi.Uint32, ffi.Uint32, ffi.Uint16)>>
+      get transport_socket_collect_tcp_options => _library._transport_socket_collect_tcp_optionsPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int64 Function(ffi.Int, ffi.Pointer<transport_socket_option_t>, ffi.Uint32)>> get transport_socket_apply_options => _library._transport_socket_apply_optionsPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Uint64)>> get transport_socket_tcp_type => _library._transport_socket_tcp_typePtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Int64 Function(ffi.Uint64, ffi.Uint32, ffi.Uint32, ffi.Uint32, ffi.Uint32, ffi.Uint16, ffi.Uint32, ffi.Uint32, ffi.Uint32, ffi.Uint32, ffi.Uint16)>>
       get transport_socket_create_tcp => _library._transport_socket_create_tcpPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Int64 Function(ffi.Uint64, ffi.Uint32, ffi.Uint32, ffi.Uint32, ffi.Uint32, ffi.Uint16, ffi.Pointer<ip_mreqn>, ffi.Uint32)>> get transport_socket_create_udp =>
@@ -10980,6 +11752,9 @@ class _SymbolAddresses {
   ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Int, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Char>)>> get transport_socket_multicast_drop_source_membership =>
       _library._transport_socket_multicast_drop_source_membershipPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<ffi.Char>)>> get transport_socket_get_interface_index => _library._transport_socket_get_interface_indexPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Int)>> get transport_socket_enable_tls => _library._transport_socket_enable_tlsPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Int, ffi.Bool, ffi.Uint16, ffi.Uint16, ffi.Pointer<ffi.Uint8>, ffi.Size, ffi.Pointer<ffi.Uint8>, ffi.Size, ffi.Pointer<ffi.Uint8>, ffi.Size, ffi.Pointer<ffi.Uint8>)>>
+      get transport_socket_set_tls_keys => _library._transport_socket_set_tls_keysPtr;
 }
 
 final class iovec extends ffi.Struct {
@@ -13140,6 +13915,17 @@ abstract class transport_socket_family {
   static const int UNIX = 1;
 }
 
+abstract class transport_operation {
+  static const int TRANSPORT_OPERATION_READ = 0;
+  static const int TRANSPORT_OPERATION_WRITE = 1;
+  static const int TRANSPORT_OPERATION_RECEIVE_MESSAGE = 2;
+  static const int TRANSPORT_OPERATION_SEND_MESSAGE = 3;
+  static const int TRANSPORT_OPERATION_CONNECT = 4;
+  static const int TRANSPORT_OPERATION_ACCEPT = 5;
+  static const int TRANSPORT_OPERATION_FILE = 6;
+  static const int TRANSPORT_OPERATIONS_COUNT = 7;
+}
+
 final class transport_buffers_pool extends ffi.Struct {
   external ffi.Pointer<ffi.Int32> ids;
 
@@ -13190,6 +13976,22 @@ final class transport_client_configuration extends ffi.Struct {
   external int ip_multicast_ttl;
 }
 
+final class transport_socket_option extends ffi.Struct {
+  @ffi.Uint64()
+  external int flag;
+
+  @ffi.Int()
+  external int level;
+
+  @ffi.Int()
+  external int name;
+
+  @ffi.Int()
+  external int value;
+}
+
+typedef transport_socket_option_t = transport_socket_option;
+
 final class transport_client extends ffi.Struct {
   @ffi.Int()
   external int fd;
@@ -13207,6 +14009,21 @@ final class transport_client extends ffi.Struct {
 
   @ffi.Int32()
   external int family;
+
+  @ffi.Int()
+  external int socket_domain;
+
+  @ffi.Int()
+  external int socket_type;
+
+  @ffi.Int()
+  external int socket_protocol;
+
+  @ffi.Array.multi([24])
+  external ffi.Array<transport_socket_option_t> options;
+
+  @ffi.Uint32()
+  external int options_count;
 }
 
 typedef transport_client_t = transport_client;
@@ -13222,6 +14039,9 @@ final class mh_events_node_t extends ffi.Struct {
   @ffi.Uint64()
   external int timestamp;
 
+  @ffi.Uint64()
+  external int started;
+
   @ffi.Int()
   external int fd;
 }
@@ -13325,6 +14145,15 @@ final class transport_worker_configuration extends ffi.Struct {
   @ffi.Uint16()
   external int buffers_count;
 
+  @ffi.Uint16()
+  external int buffers_max_count;
+
+  @ffi.Double()
+  external double buffers_grow_occupancy;
+
+  @ffi.Double()
+  external double buffers_shrink_occupancy;
+
   @ffi.Uint32()
   external int buffer_size;
 
@@ -13357,8 +14186,134 @@ final class transport_worker_configuration extends ffi.Struct {
 
   @ffi.Bool()
   external bool trace;
+
+  @ffi.Uint32()
+  external int trace_capacity;
+}
+
+final class transport_histogram extends ffi.Struct {
+  @ffi.Uint64()
+  external int count;
+
+  @ffi.Uint64()
+  external int sum;
+
+  @ffi.Uint64()
+  external int min;
+
+  @ffi.Uint64()
+  external int max;
+
+  @ffi.Array.multi([976])
+  external ffi.Array<ffi.Uint64> buckets;
+}
+
+typedef transport_histogram_t = transport_histogram;
+
+abstract class transport_trace_kind {
+  static const int TRANSPORT_TRACE_SUBMIT = 0;
+  static const int TRANSPORT_TRACE_COMPLETE = 1;
+  static const int TRANSPORT_TRACE_CANCEL = 2;
+}
+
+final class transport_trace_entry extends ffi.Struct {
+  @ffi.Uint64()
+  external int timestamp;
+
+  @ffi.Uint64()
+  external int data;
+
+  @ffi.Int32()
+  external int result;
+
+  @ffi.Uint32()
+  external int kind;
+}
+
+typedef transport_trace_entry_t = transport_trace_entry;
+
+final class transport_trace extends ffi.Struct {
+  external ffi.Pointer<transport_trace_entry_t> entries;
+
+  @ffi.Uint64()
+  external int position;
+
+  @ffi.Uint32()
+  external int mask;
+}
+
+final class transport_worker_metrics extends ffi.Struct {
+  @ffi.Uint64()
+  external int sqes_prepared;
+
+  @ffi.Uint64()
+  external int submits;
+
+  @ffi.Uint64()
+  external int cqes_reaped;
+
+  @ffi.Uint64()
+  external int empty_peeks;
+
+  @ffi.Uint64()
+  external int sq_full_waits;
+
+  @ffi.Uint64()
+  external int timeouts;
+
+  @ffi.Uint64()
+  external int cancellations;
+
+  @ffi.Uint64()
+  external int bytes_read;
+
+  @ffi.Uint64()
+  external int bytes_written;
+
+  @ffi.Uint64()
+  external int bytes_received;
+
+  @ffi.Uint64()
+  external int bytes_sent;
+
+  @ffi.Uint64()
+  external int unrouted_completions;
+}
+
+abstract class transport_worker_slot_state {
+  static const int TRANSPORT_WORKER_SLOT_FREE = 0;
+  static const int TRANSPORT_WORKER_SLOT_ACTIVE = 1;
+  static const int TRANSPORT_WORKER_SLOT_CANCELED = 2;
+}
+
+final class transport_worker_slot extends ffi.Struct {
+  @ffi.Uint64()
+  external int data;
+
+  @ffi.Int64()
+  external int timeout;
+
+  @ffi.Uint64()
+  external int timestamp;
+
+  @ffi.Uint64()
+  external int started;
+
+  @ffi.Int()
+  external int fd;
+
+  @ffi.Uint32()
+  external int next;
+
+  @ffi.Uint16()
+  external int generation;
+
+  @ffi.Uint8()
+  external int state;
 }
 
+typedef transport_worker_slot_t = transport_worker_slot;
+
 final class transport_worker extends ffi.Struct {
   @ffi.Uint8()
   external int id;
@@ -13391,7 +14346,19 @@ final class transport_worker extends ffi.Struct {
 
   external ffi.Pointer<msghdr> unix_used_messages;
 
-  external ffi.Pointer<mh_events_t> events;
+  external ffi.Pointer<transport_worker_slot_t> slots;
+
+  @ffi.Uint32()
+  external int slots_capacity;
+
+  @ffi.Uint32()
+  external int slots_free;
+
+  @ffi.Uint32()
+  external int slots_used;
+
+  @ffi.Bool()
+  external bool slots_chain_failed;
 
   @ffi.Size()
   external int ring_size;
@@ -13412,11 +14379,80 @@ final class transport_worker extends ffi.Struct {
 
   @ffi.Bool()
   external bool trace;
+
+  @ffi.Uint64()
+  external int reap_timestamp;
+
+  external ffi.Pointer<transport_worker_metrics_t> metrics;
+
+  @ffi.Uint64()
+  external int reap_monotonic;
+
+  external ffi.Pointer<transport_histogram_t> latencies;
+
+  external transport_trace trace_ring;
+
+  @ffi.Bool()
+  external bool ring_sockets;
+
+  @ffi.Bool()
+  external bool ring_socket_options;
+
+  @ffi.Uint16()
+  external int buffers_initial_count;
+
+  @ffi.Uint16()
+  external int buffers_max_count;
+
+  @ffi.Double()
+  external double buffers_grow_occupancy;
+
+  @ffi.Double()
+  external double buffers_shrink_occupancy;
+
+  @ffi.Bool()
+  external bool buffers_sparse;
+
+  external ffi.Pointer<ffi.Uint32> handles;
+
+  @ffi.Uint32()
+  external int handles_capacity;
 }
 
+typedef transport_worker_metrics_t = transport_worker_metrics;
+
 typedef transport_worker_t = transport_worker;
 typedef transport_worker_configuration_t = transport_worker_configuration;
 
+final class transport_shared_ring extends ffi.Opaque {}
+
+final class transport_shared extends ffi.Struct {
+  @ffi.Int()
+  external int fd;
+
+  @ffi.Int()
+  external int memory_fd;
+
+  external ffi.Pointer<ffi.Void> memory;
+
+  @ffi.Size()
+  external int memory_size;
+
+  @ffi.Uint32()
+  external int capacity;
+
+  external ffi.Pointer<transport_shared_ring_t> inbound;
+
+  external ffi.Pointer<transport_shared_ring_t> outbound;
+
+  external ffi.Pointer<ffi.Uint8> inbound_data;
+
+  external ffi.Pointer<ffi.Uint8> outbound_data;
+}
+
+typedef transport_shared_ring_t = transport_shared_ring;
+typedef transport_shared_t = transport_shared;
+
 const int MSG_OOB = 1;
 
 const int MSG_PEEK = 2;
@@ -17885,6 +18921,20 @@ const int TRANSPORT_EVENT_FILE = 128;
 
 const int TRANSPORT_EVENT_SERVER = 256;
 
+const int TRANSPORT_EVENT_SYNC = 512;
+
+const int TRANSPORT_EVENT_ALLOCATE = 1024;
+
+const int TRANSPORT_EVENT_ADVISE = 2048;
+
+const int TRANSPORT_EVENT_MESSAGE = 4096;
+
+const int TRANSPORT_EVENT_SHARED = 8192;
+
+const int TRANSPORT_EVENT_SOCKET = 16384;
+
+const int TRANSPORT_EVENT_SLOT = 32768;
+
 const int TRANSPORT_READ_ONLY = 1;
 
 const int TRANSPORT_WRITE_ONLY = 2;
@@ -17957,6 +19007,12 @@ const int TRANSPORT_SOCKET_OPTION_TCP_NODELAY = 268435456;
 
 const int TRANSPORT_SOCKET_OPTION_TCP_SYNCNT = 536870912;
 
+const int TRANSPORT_SOCKET_OPTION_UDP_GRO = 1073741824;
+
+const int TRANSPORT_SOCKET_OPTION_SOCKET_TIMESTAMPING = 2147483648;
+
+const int TRANSPORT_SOCKET_OPTION_TCP_FASTOPEN_CONNECT = 4294967296;
+
 const int MH_SOURCE = 1;
 
 const int MH_INCREMENTAL_RESIZE = 1;
@@ -18018,3 +19074,22 @@ const double M_SQRT2 = 1.4142135623730951;
 const double M_SQRT1_2 = 0.7071067811865476;
 
 const int MH_TYPEDEFS = 1;
+
+const int TRANSPORT_SOCKET_OPTIONS_MAX = 24;
+
+const int TRANSPORT_WORKER_METRICS_ALIGNMENT = 64;
+const int TRANSPORT_WORKER_BUFFERS_LIMIT = 16384;
+
+const int TRANSPORT_WORKER_SLOT_NONE = 4294967295;
+
+const int TRANSPORT_WORKER_SLOT_INDEX_SHIFT = 16;
+
+const int TRANSPORT_WORKER_SLOT_GENERATION_SHIFT = 48;
+
+const int TRANSPORT_SHARED_CACHE_LINE = 64;
+
+const int TRANSPORT_HISTOGRAM_SUB_BUCKET_BITS = 4;
+
+const int TRANSPORT_HISTOGRAM_SUB_BUCKETS = 16;
+
+const int TRANSPORT_HISTOGRAM_BUCKETS = 976;
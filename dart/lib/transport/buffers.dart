@@ -1,29 +1,100 @@
 import 'dart:async';
 import 'dart:collection';
 import 'dart:ffi';
+import 'dart:math';
 import 'dart:typed_data';
 
 import 'bindings.dart';
+import 'callbacks.dart';
 import 'constants.dart';
 
 class TransportBuffers {
   final TransportBindings _bindings;
   final Pointer<iovec> buffers;
-  final Queue<Completer<void>> _finalizers = Queue();
+  final Queue<Completer<int>> _finalizers = Queue();
+  final _availabilityWaiters = <(double, Completer<void>)>[];
+  final _growthListeners = <void Function(int buffersCount)>[];
   final Pointer<transport_worker_t> _worker;
 
   late final int bufferSize;
-  late final int buffersCount;
+  late final bool _elastic;
+  late final TransportCallbacks callbacks;
+  late int buffersCount;
+
+  var _growBelow = -1;
+  var _shrinkAbove = 0;
+  var _releases = 0;
 
   TransportBuffers(this._bindings, this.buffers, this._worker) {
     bufferSize = _worker.ref.buffer_size;
     buffersCount = _worker.ref.buffers_count;
+    callbacks = TransportCallbacks(buffersCount);
+    _elastic = _worker.ref.buffers_sparse;
+    _updateThresholds();
   }
 
   @pragma(preferInlinePragma)
   void release(int bufferId) {
     _bindings.transport_worker_release_buffer(_worker, bufferId);
-    if (_finalizers.isNotEmpty) _finalizers.removeLast().complete();
+    if (_finalizers.isNotEmpty) {
+      _finalizers.removeFirst().complete(_bindings.transport_worker_get_buffer(_worker));
+      return;
+    }
+    if (_availabilityWaiters.isNotEmpty) _notifyAvailability();
+    if (_elastic && _worker.ref.free_buffers.count > _shrinkAbove && ++_releases >= buffersCount) _shrink();
+  }
+
+  void onGrowth(void Function(int buffersCount) listener) => _growthListeners.add(listener);
+
+  void _grow() {
+    final result = _bindings.transport_worker_grow_buffers(_worker, buffersCount);
+    if (result <= buffersCount) {
+      _growBelow = -1;
+      return;
+    }
+    buffersCount = result;
+    callbacks.grow(buffersCount);
+    for (var listener in _growthListeners) listener(buffersCount);
+    _updateThresholds();
+    while (_finalizers.isNotEmpty) {
+      final bufferId = _bindings.transport_worker_get_buffer(_worker);
+      if (bufferId == transportBufferUsed) break;
+      _finalizers.removeFirst().complete(bufferId);
+    }
+    if (_availabilityWaiters.isNotEmpty) _notifyAvailability();
+  }
+
+  void _shrink() {
+    _releases = 0;
+    final result = _bindings.transport_worker_shrink_buffers(_worker, buffersCount ~/ 2);
+    if (result >= buffersCount) return;
+    buffersCount = result;
+    _updateThresholds();
+    if (_availabilityWaiters.isNotEmpty) _notifyAvailability();
+  }
+
+  void _updateThresholds() {
+    _releases = 0;
+    if (!_elastic) return;
+    final worker = _worker.ref;
+    _growBelow = buffersCount < worker.buffers_max_count ? (buffersCount * (1 - worker.buffers_grow_occupancy)).floor() : -1;
+    _shrinkAbove = buffersCount > worker.buffers_initial_count ? (buffersCount * (1 - worker.buffers_shrink_occupancy)).ceil() : buffersCount;
+  }
+
+  Future<void> whenOccupancyBelow(double occupancy) {
+    if (used() <= (buffersCount * occupancy).floor()) return Future.value();
+    final completer = Completer<void>();
+    _availabilityWaiters.add((occupancy, completer));
+    return completer.future;
+  }
+
+  void _notifyAvailability() {
+    final used = this.used();
+    _availabilityWaiters.removeWhere((waiter) {
+      if (used > (buffersCount * waiter.$1).floor()) return false;
+      waiter.$2.complete();
+      return true;
+    });
   }
 
   @pragma(preferInlinePragma)
@@ -43,27 +114,43 @@ class TransportBuffers {
     buffer.ref.iov_len = bytes.length;
   }
 
+  @pragma(preferInlinePragma)
+  void writeSegments(int bufferId, List<Uint8List> bytes, int start, int end) {
+    final buffer = buffers.elementAt(bufferId);
+    final bufferBytes = buffer.ref.iov_base.cast<Uint8>().asTypedList(bufferSize);
+    var offset = 0;
+    for (var index = start; index < end; index++) {
+      bufferBytes.setAll(offset, bytes[index]);
+      offset += bytes[index].length;
+    }
+    buffer.ref.iov_len = offset;
+  }
+
+  int segmentsPerBuffer(List<Uint8List> bytes) {
+    final segmentSize = bytes.first.length;
+    if (segmentSize == 0 || segmentSize > bufferSize) return 0;
+    for (var index = 1; index < bytes.length - 1; index++) {
+      if (bytes[index].length != segmentSize) return 0;
+    }
+    if (bytes.last.length > segmentSize) return 0;
+    return min(bufferSize ~/ segmentSize, transportUdpMaxSegments);
+  }
+
   @pragma(preferInlinePragma)
   int? get() {
+    if (_elastic && _worker.ref.free_buffers.count <= _growBelow) _grow();
     final buffer = _bindings.transport_worker_get_buffer(_worker);
     if (buffer == transportBufferUsed) return null;
     return buffer;
   }
 
-  Future<int> allocate() async {
-    var bufferId = _bindings.transport_worker_get_buffer(_worker);
-    while (bufferId == transportBufferUsed) {
-      if (_finalizers.isNotEmpty) {
-        await _finalizers.last.future;
-        bufferId = _bindings.transport_worker_get_buffer(_worker);
-        continue;
-      }
-      final completer = Completer();
-      _finalizers.add(completer);
-      await completer.future;
-      bufferId = _bindings.transport_worker_get_buffer(_worker);
-    }
-    return bufferId;
+  Future<int> allocate() {
+    if (_elastic && _worker.ref.free_buffers.count <= _growBelow) _grow();
+    final bufferId = _bindings.transport_worker_get_buffer(_worker);
+    if (bufferId != transportBufferUsed) return Future.value(bufferId);
+    final completer = Completer<int>();
+    _finalizers.addLast(completer);
+    return completer.future;
   }
 
   Future<List<int>> allocateArray(int count) async {
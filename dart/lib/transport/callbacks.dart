@@ -0,0 +1,102 @@
+import 'dart:typed_data';
+
+import 'constants.dart';
+import 'payload.dart';
+
+final transportCompleted = Future<void>.value();
+
+class TransportCallbacks {
+  final List<void Function()?> _done;
+  final List<void Function(Exception error)?> _errors;
+  final List<void Function(TransportPayload payload)?> _reads;
+  final List<void Function(int result)?> _results;
+  Int64List _starts;
+
+  TransportCallbacks(int buffersCount)
+      : _done = List.filled(buffersCount, null, growable: true),
+        _errors = List.filled(buffersCount, null, growable: true),
+        _reads = List.filled(buffersCount, null, growable: true),
+        _results = List.filled(buffersCount, null, growable: true),
+        _starts = Int64List(buffersCount)..fillRange(0, buffersCount, -1);
+
+  void grow(int buffersCount) {
+    final current = _starts.length;
+    if (buffersCount <= current) return;
+    _done.length = buffersCount;
+    _errors.length = buffersCount;
+    _reads.length = buffersCount;
+    _results.length = buffersCount;
+    _starts = (Int64List(buffersCount)..fillRange(current, buffersCount, -1))..setAll(0, _starts);
+  }
+
+  @pragma(preferInlinePragma)
+  void setOutbound(int bufferId, void Function(Exception error)? onError, void Function()? onDone) {
+    _errors[bufferId] = onError;
+    _done[bufferId] = onDone;
+  }
+
+  @pragma(preferInlinePragma)
+  void setInbound(int bufferId, void Function(TransportPayload payload)? onRead, void Function(Exception error)? onError) {
+    _reads[bufferId] = onRead;
+    _errors[bufferId] = onError;
+  }
+
+  @pragma(preferInlinePragma)
+  void setResult(int bufferId, void Function(int result) onResult) => _results[bufferId] = onResult;
+
+  @pragma(preferInlinePragma)
+  void notifyDone(int bufferId) {
+    final onDone = _done[bufferId];
+    _done[bufferId] = null;
+    _errors[bufferId] = null;
+    onDone?.call();
+  }
+
+  @pragma(preferInlinePragma)
+  void notifyError(int bufferId, Exception error) {
+    final onError = _errors[bufferId];
+    _done[bufferId] = null;
+    _errors[bufferId] = null;
+    onError?.call(error);
+  }
+
+  @pragma(preferInlinePragma)
+  void Function(TransportPayload payload)? takeRead(int bufferId) {
+    final onRead = _reads[bufferId];
+    _reads[bufferId] = null;
+    return onRead;
+  }
+
+  @pragma(preferInlinePragma)
+  void Function(Exception error)? takeError(int bufferId) {
+    final onError = _errors[bufferId];
+    _errors[bufferId] = null;
+    return onError;
+  }
+
+  @pragma(preferInlinePragma)
+  void Function(int result)? takeResult(int bufferId) {
+    final onResult = _results[bufferId];
+    _results[bufferId] = null;
+    return onResult;
+  }
+
+  @pragma(preferInlinePragma)
+  void stamp(int bufferId, int timestamp) => _starts[bufferId] = timestamp;
+
+  @pragma(preferInlinePragma)
+  int takeStamp(int bufferId) {
+    final start = _starts[bufferId];
+    _starts[bufferId] = -1;
+    return start;
+  }
+
+  @pragma(preferInlinePragma)
+  void clear(int bufferId) {
+    _done[bufferId] = null;
+    _errors[bufferId] = null;
+    _reads[bufferId] = null;
+    _results[bufferId] = null;
+    _starts[bufferId] = -1;
+  }
+}
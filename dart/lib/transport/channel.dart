@@ -1,8 +1,11 @@
 import 'dart:ffi';
 import 'dart:typed_data';
 
+import 'package:ffi/ffi.dart';
+
 import 'bindings.dart';
 import 'buffers.dart';
+import 'configuration.dart';
 import 'constants.dart';
 
 class TransportChannel {
@@ -53,6 +56,71 @@ class TransportChannel {
     );
   }
 
+  @pragma(preferInlinePragma)
+  void sync(
+    int bufferId,
+    int event, {
+    bool dataOnly = false,
+    int sqeFlags = 0,
+    int? timeout,
+  }) {
+    _bindings.transport_worker_sync(
+      _workerPointer,
+      fd,
+      bufferId,
+      dataOnly,
+      timeout ?? transportTimeoutInfinity,
+      event,
+      sqeFlags,
+    );
+  }
+
+  @pragma(preferInlinePragma)
+  void allocate(
+    int bufferId,
+    int event, {
+    int mode = 0,
+    int offset = 0,
+    int length = 0,
+    int sqeFlags = 0,
+    int? timeout,
+  }) {
+    _bindings.transport_worker_allocate(
+      _workerPointer,
+      fd,
+      bufferId,
+      mode,
+      offset,
+      length,
+      timeout ?? transportTimeoutInfinity,
+      event,
+      sqeFlags,
+    );
+  }
+
+  @pragma(preferInlinePragma)
+  void advise(
+    int bufferId,
+    Pointer<Void> address,
+    int length,
+    int advice,
+    int event, {
+    int sqeFlags = 0,
+    int? timeout,
+  }) {
+    _bindings.transport_worker_advise(
+      _workerPointer,
+      fd,
+      bufferId,
+      address,
+      length,
+      advice,
+      timeout ?? transportTimeoutInfinity,
+      event,
+      sqeFlags,
+    );
+  }
+
   @pragma(preferInlinePragma)
   void receiveMessage(
     int bufferId,
@@ -99,6 +167,67 @@ class TransportChannel {
     );
   }
 
+  @pragma(preferInlinePragma)
+  void sendMessageSegmented(
+    List<Uint8List> bytes,
+    int start,
+    int end,
+    int bufferId,
+    int socketFamily,
+    Pointer<sockaddr> destination,
+    int messageFlags,
+    int event, {
+    int? timeout,
+    int sqeFlags = 0,
+  }) {
+    _buffers.writeSegments(bufferId, bytes, start, end);
+    _bindings.transport_worker_send_message_segmented(
+      _workerPointer,
+      fd,
+      bufferId,
+      destination,
+      socketFamily,
+      messageFlags,
+      bytes[start].length,
+      timeout ?? transportTimeoutInfinity,
+      event,
+      sqeFlags,
+    );
+  }
+
+  int enableTls(TransportTlsKeys transmit, TransportTlsKeys? receive) {
+    final result = _bindings.transport_socket_enable_tls(fd);
+    if (result < 0) return result;
+    final transmitResult = _setTlsKeys(transmit, false);
+    if (transmitResult < 0 || receive == null) return transmitResult;
+    return _setTlsKeys(receive, true);
+  }
+
+  int _setTlsKeys(TransportTlsKeys keys, bool receive) {
+    if (keys.sequence.length != transportTlsSequenceLength) return -EINVAL;
+    return using((arena) {
+      Pointer<Uint8> copy(Uint8List bytes) {
+        final pointer = arena<Uint8>(bytes.length + 1);
+        pointer.asTypedList(bytes.length).setAll(0, bytes);
+        return pointer;
+      }
+
+      return _bindings.transport_socket_set_tls_keys(
+        fd,
+        receive,
+        keys.version.version,
+        keys.cipher.cipher,
+        copy(keys.key),
+        keys.key.length,
+        copy(keys.iv),
+        keys.iv.length,
+        copy(keys.salt),
+        keys.salt.length,
+        copy(keys.sequence),
+      );
+    });
+  }
+
   @pragma(preferInlinePragma)
   void close() => _bindings.transport_close_descriptor(fd);
 }
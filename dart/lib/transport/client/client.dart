@@ -1,22 +1,27 @@
 import 'dart:async';
 import 'dart:ffi';
+import 'dart:math';
 import 'dart:typed_data';
 
 import 'package:meta/meta.dart';
 
 import '../bindings.dart';
 import '../buffers.dart';
+import '../callbacks.dart';
 import '../channel.dart';
+import '../configuration.dart';
 import '../constants.dart';
 import '../exception.dart';
 import '../payload.dart';
+import '../watermarks.dart';
+import 'multiplexer.dart';
 import 'provider.dart';
 import 'registry.dart';
 
+final _clock = Stopwatch()..start();
+
 class TransportClientChannel {
   final _inboundEvents = StreamController<TransportPayload>();
-  final _outboundDoneHandlers = <int, void Function()>{};
-  final _outboundErrorHandlers = <int, void Function(Exception error)>{};
   final Pointer<transport_client_t> _pointer;
   final Pointer<transport_worker_t> _workerPointer;
   final TransportChannel _channel;
@@ -25,8 +30,12 @@ class TransportClientChannel {
   final int? _readTimeout;
   final int? _writeTimeout;
   final TransportBuffers _buffers;
+  final TransportCallbacks _callbacks;
   final TransportClientRegistry _registry;
   final TransportPayloadPool _payloadPool;
+  final bool _timestamps;
+  final bool _latencyTracking;
+  final TransportOutboundWatermarks _watermarks;
 
   late final Pointer<sockaddr> _destination;
 
@@ -34,9 +43,16 @@ class TransportClientChannel {
   var _pending = 0;
   var _active = true;
   var _closing = false;
+  var _latency = 0;
+  var _optionFailure = 0;
   final _closer = Completer();
 
   bool get active => !_closing;
+  int get pending => _pending;
+  int get latency => _latency;
+  int get bufferSize => _buffers.bufferSize;
+  bool get writable => _watermarks.writable;
+  int get outbound => _watermarks.outbound;
   Stream<TransportPayload> get inbound => _inboundEvents.stream;
 
   TransportClientChannel(
@@ -50,30 +66,79 @@ class TransportClientChannel {
     this._registry,
     this._payloadPool, {
     int? connectTimeout,
-  }) : _connectTimeout = connectTimeout {
+    bool timestamps = false,
+    bool latencyTracking = false,
+    TransportOutboundWatermarks? watermarks,
+  })  : _connectTimeout = connectTimeout,
+        _timestamps = timestamps,
+        _latencyTracking = latencyTracking,
+        _callbacks = _buffers.callbacks,
+        _watermarks = watermarks ?? TransportOutboundWatermarks(null, null) {
     _destination = _bindings.transport_client_get_destination_address(_pointer);
   }
 
-  Future<void> read() async {
+  @pragma(preferInlinePragma)
+  bool tryRead() {
+    if (_closing) return false;
+    final bufferId = _buffers.get();
+    if (bufferId == null) return false;
+    _channel.read(bufferId, transportEventRead | transportEventClient, timeout: _readTimeout);
+    _pending++;
+    return true;
+  }
+
+  @pragma(preferInlinePragma)
+  Future<void> read() => tryRead() ? transportCompleted : _read();
+
+  Future<void> _read() async {
     final bufferId = _buffers.get() ?? await _buffers.allocate();
     if (_closing) return Future.error(TransportClosedException.forClient());
     _channel.read(bufferId, transportEventRead | transportEventClient, timeout: _readTimeout);
     _pending++;
   }
 
-  Future<void> writeSingle(Uint8List bytes, {void Function(Exception error)? onError, void Function()? onDone}) async {
+  @pragma(preferInlinePragma)
+  Future<void> whenWritable() => _watermarks.whenWritable();
+
+  @pragma(preferInlinePragma)
+  bool tryWriteSingle(Uint8List bytes, {void Function(Exception error)? onError, void Function()? onDone}) {
+    if (_closing || !_watermarks.writable) return false;
+    final bufferId = _buffers.get();
+    if (bufferId == null) return false;
+    _writeSingle(bufferId, bytes, onError, onDone);
+    return true;
+  }
+
+  @pragma(preferInlinePragma)
+  Future<void> writeSingle(Uint8List bytes, {void Function(Exception error)? onError, void Function()? onDone}) =>
+      tryWriteSingle(bytes, onError: onError, onDone: onDone) ? transportCompleted : _writeSingleAsync(bytes, onError, onDone);
+
+  Future<void> _writeSingleAsync(Uint8List bytes, void Function(Exception error)? onError, void Function()? onDone) async {
+    while (!_watermarks.writable) await _watermarks.whenWritable();
     final bufferId = _buffers.get() ?? await _buffers.allocate();
     if (_closing) return Future.error(TransportClosedException.forClient());
-    if (onError != null) _outboundErrorHandlers[bufferId] = onError;
-    if (onDone != null) _outboundDoneHandlers[bufferId] = onDone;
+    _writeSingle(bufferId, bytes, onError, onDone);
+  }
+
+  @pragma(preferInlinePragma)
+  void _writeSingle(int bufferId, Uint8List bytes, void Function(Exception error)? onError, void Function()? onDone) {
+    _watermarks.acquire(1);
+    _callbacks.setOutbound(bufferId, onError, onDone);
+    if (_latencyTracking) _callbacks.stamp(bufferId, _clock.elapsedMicroseconds);
     _channel.write(bytes, bufferId, transportEventWrite | transportEventClient, timeout: _writeTimeout);
     _pending++;
   }
 
   Future<void> writeMany(List<Uint8List> bytes, {bool linked = true, void Function(Exception error)? onError, void Function()? onDone}) async {
+    while (!_watermarks.writable) await _watermarks.whenWritable();
     final bufferIds = await _buffers.allocateArray(bytes.length);
     if (_closing) return Future.error(TransportClosedException.forClient());
+    _watermarks.acquire(bytes.length);
     final lastBufferId = bufferIds.last;
+    if (_latencyTracking) {
+      final start = _clock.elapsedMicroseconds;
+      for (var bufferId in bufferIds) _callbacks.stamp(bufferId, start);
+    }
     for (var index = 0; index < bytes.length - 1; index++) {
       final bufferId = bufferIds[index];
       _channel.write(
@@ -83,8 +148,7 @@ class TransportClientChannel {
         sqeFlags: linked ? transportIosqeIoLink : 0,
         timeout: _writeTimeout,
       );
-      if (onError != null) _outboundErrorHandlers[bufferId] = onError;
-      if (onDone != null) _outboundDoneHandlers[bufferId] = onDone;
+      _callbacks.setOutbound(bufferId, onError, onDone);
     }
     _channel.write(
       bytes.last,
@@ -92,8 +156,7 @@ class TransportClientChannel {
       transportEventWrite | transportEventClient,
       timeout: _writeTimeout,
     );
-    if (onError != null) _outboundErrorHandlers[lastBufferId] = onError;
-    if (onDone != null) _outboundDoneHandlers[lastBufferId] = onDone;
+    _callbacks.setOutbound(lastBufferId, onError, onDone);
     _pending += bytes.length;
   }
 
@@ -120,8 +183,7 @@ class TransportClientChannel {
     flags = flags ?? TransportDatagramMessageFlag.trunc.flag;
     final bufferId = _buffers.get() ?? await _buffers.allocate();
     if (_closing) return Future.error(TransportClosedException.forClient());
-    if (onError != null) _outboundErrorHandlers[bufferId] = onError;
-    if (onDone != null) _outboundDoneHandlers[bufferId] = onDone;
+    _callbacks.setOutbound(bufferId, onError, onDone);
     _channel.sendMessage(
       bytes,
       bufferId,
@@ -138,10 +200,15 @@ class TransportClientChannel {
     List<Uint8List> bytes, {
     int? flags,
     bool linked = false,
+    bool segmented = false,
     void Function(Exception error)? onError,
     void Function()? onDone,
   }) async {
     flags = flags ?? TransportDatagramMessageFlag.trunc.flag;
+    if (segmented) {
+      final segments = _buffers.segmentsPerBuffer(bytes);
+      if (segments > 1) return _sendSegmented(bytes, segments, flags, linked, onError, onDone);
+    }
     final bufferIds = await _buffers.allocateArray(bytes.length);
     if (_closing) return Future.error(TransportClosedException.forClient());
     final lastBufferId = bufferIds.last;
@@ -157,8 +224,7 @@ class TransportClientChannel {
         sqeFlags: linked ? transportIosqeIoLink : 0,
         timeout: _writeTimeout,
       );
-      if (onError != null) _outboundErrorHandlers[bufferId] = onError;
-      if (onDone != null) _outboundDoneHandlers[bufferId] = onDone;
+      _callbacks.setOutbound(bufferId, onError, onDone);
     }
     _channel.sendMessage(
       bytes.last,
@@ -170,11 +236,54 @@ class TransportClientChannel {
       sqeFlags: linked ? transportIosqeIoLink : 0,
       timeout: _writeTimeout,
     );
-    if (onError != null) _outboundErrorHandlers[lastBufferId] = onError;
-    if (onDone != null) _outboundDoneHandlers[lastBufferId] = onDone;
+    _callbacks.setOutbound(lastBufferId, onError, onDone);
     _pending += bytes.length;
   }
 
+  Future<void> _sendSegmented(
+    List<Uint8List> bytes,
+    int segments,
+    int flags,
+    bool linked,
+    void Function(Exception error)? onError,
+    void Function()? onDone,
+  ) async {
+    final count = (bytes.length / segments).ceil();
+    final bufferIds = await _buffers.allocateArray(count);
+    if (_closing) return Future.error(TransportClosedException.forClient());
+    for (var index = 0; index < count; index++) {
+      final bufferId = bufferIds[index];
+      final start = index * segments;
+      final end = min(start + segments, bytes.length);
+      _channel.sendMessageSegmented(
+        bytes,
+        start,
+        end,
+        bufferId,
+        _pointer.ref.family,
+        _destination,
+        flags,
+        transportEventSendMessage | transportEventClient,
+        sqeFlags: linked && index < count - 1 ? transportIosqeIoLink : 0,
+        timeout: _writeTimeout,
+      );
+      _callbacks.setOutbound(
+        bufferId,
+        onError == null
+            ? null
+            : (error) {
+                for (var segment = start; segment < end; segment++) onError(error);
+              },
+        onDone == null
+            ? null
+            : () {
+                for (var segment = start; segment < end; segment++) onDone();
+              },
+      );
+    }
+    _pending += count;
+  }
+
   @pragma(preferInlinePragma)
   Future<TransportClientChannel> connect() {
     if (_closing) return Future.error(TransportClosedException.forClient());
@@ -183,7 +292,21 @@ class TransportClientChannel {
     return _connector.future.then((_) => this);
   }
 
-  void notifyConnect(int fd, int result) {
+  Future<TransportClientChannel> connectWithData(Uint8List bytes) async {
+    final bufferId = _buffers.get() ?? await _buffers.allocate();
+    if (_closing) return Future.error(TransportClosedException.forClient());
+    _buffers.write(bufferId, bytes);
+    _watermarks.acquire(1);
+    _callbacks.setOutbound(bufferId, _inboundEvents.addError, null);
+    _bindings.transport_worker_connect_with_data(_workerPointer, _pointer, bufferId, _connectTimeout!);
+    _pending += 2;
+    return _connector.future.then((_) => this);
+  }
+
+  @pragma(preferInlinePragma)
+  void notifyOption(int index) => _optionFailure = _pointer.ref.options[index].flag;
+
+  void notifyConnect(int result) {
     _pending--;
     if (_active) {
       if (_pending == 0 && _closing) {
@@ -194,6 +317,10 @@ class TransportClientChannel {
         _connector.complete();
         return;
       }
+      if (_optionFailure != 0) {
+        _connector.completeError(TransportInitializationException(TransportMessages.clientSocketError(-_optionFailure)));
+        return;
+      }
       if (result == -ECANCELED) {
         _connector.completeError(TransportCanceledException(TransportEvent.connect));
         return;
@@ -233,7 +360,19 @@ class TransportClientChannel {
       if (event == transportEventReceiveMessage) {
         if (result > 0) {
           _buffers.setLength(bufferId, result);
-          _inboundEvents.add(_payloadPool.getPayload(bufferId, _buffers.read(bufferId)));
+          final payload = _payloadPool.getPayload(
+            bufferId,
+            _buffers.read(bufferId),
+            segmentSize: _bindings.transport_worker_get_datagram_segment_size(_workerPointer, _pointer.ref.family, bufferId),
+          );
+          if (_timestamps) {
+            _payloadPool.stampPayload(
+              payload,
+              _bindings.transport_worker_get_datagram_timestamp(_workerPointer, _pointer.ref.family, bufferId),
+              _workerPointer.ref.reap_timestamp,
+            );
+          }
+          _inboundEvents.add(payload);
           return;
         }
         _buffers.release(bufferId);
@@ -242,29 +381,44 @@ class TransportClientChannel {
       }
       if (event == transportEventWrite) {
         _buffers.release(bufferId);
+        _watermarks.release();
+        if (_latencyTracking) _trackLatency(bufferId);
         if (result > 0) {
-          _outboundDoneHandlers.remove(bufferId)?.call();
+          _callbacks.notifyDone(bufferId);
           return;
         }
-        _outboundErrorHandlers.remove(bufferId)?.call(createTransportException(TransportEvent.clientEvent(event), result, _bindings));
+        _callbacks.notifyError(bufferId, createTransportException(TransportEvent.clientEvent(event), result, _bindings));
         return;
       }
       if (event == transportEventSendMessage) {
         _buffers.release(bufferId);
         if (result > 0) {
-          _outboundDoneHandlers.remove(bufferId)?.call();
+          _callbacks.notifyDone(bufferId);
           return;
         }
-        _outboundErrorHandlers.remove(bufferId)?.call(createTransportException(TransportEvent.clientEvent(event), result, _bindings));
+        _callbacks.notifyError(bufferId, createTransportException(TransportEvent.clientEvent(event), result, _bindings));
         return;
       }
       _buffers.release(bufferId);
       return;
     }
+    _callbacks.clear(bufferId);
     _buffers.release(bufferId);
     if (_pending == 0 && _closing && !_closer.isCompleted) _closer.complete();
   }
 
+  void enableTls(TransportTlsKeys transmit, TransportTlsKeys? receive) {
+    if (_closing) throw TransportClosedException.forClient();
+    final result = _channel.enableTls(transmit, receive);
+    if (result < 0) throw TransportInitializationException(TransportMessages.tlsError(result, _bindings));
+  }
+
+  @pragma(preferInlinePragma)
+  void _trackLatency(int bufferId) {
+    final start = _callbacks.takeStamp(bufferId);
+    if (start >= 0) _latency += (_clock.elapsedMicroseconds - start - _latency) >> 3;
+  }
+
   Future<void> close({Duration? gracefulTimeout}) async {
     if (_closing) {
       if (!_closer.isCompleted) {
@@ -273,6 +427,7 @@ class TransportClientChannel {
       return;
     }
     _closing = true;
+    _watermarks.reset();
     if (_pending > 0) {
       if (gracefulTimeout == null) {
         _active = false;
@@ -292,8 +447,8 @@ class TransportClientChannel {
     }
     _active = false;
     if (_inboundEvents.hasListener) await _inboundEvents.close();
-    _channel.close();
     _registry.remove(_pointer.ref.fd);
+    _channel.close();
     _bindings.transport_client_destroy(_pointer);
   }
 
@@ -303,25 +458,72 @@ class TransportClientChannel {
 
 class TransportClientConnectionPool {
   final List<TransportClientConnection> _clients;
+  final TransportClientSelection _selection;
+  final _random = Random();
   var _next = 0;
 
   List<TransportClientConnection> get clients => _clients;
 
-  TransportClientConnectionPool(this._clients);
+  TransportClientConnectionPool(this._clients, {TransportClientSelection selection = TransportClientSelection.roundRobin}) : _selection = selection;
 
   @pragma(preferInlinePragma)
   TransportClientConnection select() {
-    final provider = _clients[_next];
+    switch (_selection) {
+      case TransportClientSelection.roundRobin:
+        return _selectRoundRobin();
+      case TransportClientSelection.leastOutstanding:
+        return _selectLeastOutstanding();
+      case TransportClientSelection.powerOfTwoChoices:
+        return _selectPowerOfTwoChoices();
+    }
+  }
+
+  TransportClientConnection _selectRoundRobin() {
+    for (var attempt = 0; attempt < _clients.length; attempt++) {
+      final provider = _clients[_next];
+      if (++_next == _clients.length) _next = 0;
+      if (provider.active) return provider;
+    }
+    return _clients[_next];
+  }
+
+  TransportClientConnection _selectLeastOutstanding() {
+    var selected = _clients[_next];
+    var selectedPending = selected.active ? selected.pending : -1;
+    for (var index = 1; index < _clients.length; index++) {
+      final provider = _clients[(_next + index) % _clients.length];
+      if (!provider.active) continue;
+      if (selectedPending == -1 || provider.pending < selectedPending) {
+        selected = provider;
+        selectedPending = provider.pending;
+      }
+    }
     if (++_next == _clients.length) _next = 0;
-    return provider;
+    return selected;
+  }
+
+  TransportClientConnection _selectPowerOfTwoChoices() {
+    if (_clients.length == 1) return _clients.first;
+    final first = _clients[_random.nextInt(_clients.length)];
+    var second = _clients[_random.nextInt(_clients.length - 1)];
+    if (identical(second, first)) second = _clients.last;
+    if (!first.active) return second.active ? second : _selectRoundRobin();
+    if (!second.active) return first;
+    return _load(second) < _load(first) ? second : first;
   }
 
+  @pragma(preferInlinePragma)
+  int _load(TransportClientConnection provider) => (provider.latency + 1) * (provider.pending + 1);
+
   @pragma(preferInlinePragma)
   void forEach(FutureOr<void> Function(TransportClientConnection provider) action) => _clients.forEach(action);
 
   @pragma(preferInlinePragma)
   int count() => _clients.length;
 
+  @pragma(preferInlinePragma)
+  TransportMultiplexedClient multiplex({Duration? deadline}) => TransportMultiplexedClient(this, deadline);
+
   @pragma(preferInlinePragma)
   Future<void> close({Duration? gracefulTimeout}) => Future.wait(_clients.toList().map((provider) => provider.close(gracefulTimeout: gracefulTimeout)));
 }
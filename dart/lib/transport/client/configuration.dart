@@ -1,10 +1,14 @@
 import '../configuration.dart';
+import '../constants.dart';
 
 class TransportTcpClientConfiguration {
   final int pool;
+  final TransportClientSelection? selection;
   final Duration? connectTimeout;
   final Duration? readTimeout;
   final Duration? writeTimeout;
+  final int? outboundHighWatermark;
+  final int? outboundLowWatermark;
   final int? socketReceiveBufferSize;
   final int? socketSendBufferSize;
   final bool? socketNonblock;
@@ -19,6 +23,7 @@ class TransportTcpClientConfiguration {
   final bool? tcpQuickack;
   final bool? tcpDeferAccept;
   final bool? tcpFastopen;
+  final bool? tcpFastopenConnect;
   final int? tcpKeepAliveIdle;
   final int? tcpKeepAliveMaxCount;
   final int? tcpKeepAliveIndividualCount;
@@ -28,9 +33,12 @@ class TransportTcpClientConfiguration {
 
   TransportTcpClientConfiguration({
     required this.pool,
+    this.selection,
     this.connectTimeout,
     this.readTimeout,
     this.writeTimeout,
+    this.outboundHighWatermark,
+    this.outboundLowWatermark,
     this.socketReceiveBufferSize,
     this.socketSendBufferSize,
     this.socketNonblock,
@@ -45,6 +53,7 @@ class TransportTcpClientConfiguration {
     this.tcpQuickack,
     this.tcpDeferAccept,
     this.tcpFastopen,
+    this.tcpFastopenConnect,
     this.tcpKeepAliveIdle,
     this.tcpKeepAliveMaxCount,
     this.tcpKeepAliveIndividualCount,
@@ -55,9 +64,12 @@ class TransportTcpClientConfiguration {
 
   TransportTcpClientConfiguration copyWith({
     int? pool,
+    TransportClientSelection? selection,
     Duration? connectTimeout,
     Duration? readTimeout,
     Duration? writeTimeout,
+    int? outboundHighWatermark,
+    int? outboundLowWatermark,
     int? socketReceiveBufferSize,
     int? socketSendBufferSize,
     bool? socketNonblock,
@@ -72,6 +84,7 @@ class TransportTcpClientConfiguration {
     bool? tcpQuickack,
     bool? tcpDeferAccept,
     bool? tcpFastopen,
+    bool? tcpFastopenConnect,
     int? tcpKeepAliveIdle,
     int? tcpKeepAliveMaxCount,
     int? tcpKeepAliveIndividualCount,
@@ -81,9 +94,12 @@ class TransportTcpClientConfiguration {
   }) =>
       TransportTcpClientConfiguration(
         pool: pool ?? this.pool,
+        selection: selection ?? this.selection,
         connectTimeout: connectTimeout ?? this.connectTimeout,
         readTimeout: readTimeout ?? this.readTimeout,
         writeTimeout: writeTimeout ?? this.writeTimeout,
+        outboundHighWatermark: outboundHighWatermark ?? this.outboundHighWatermark,
+        outboundLowWatermark: outboundLowWatermark ?? this.outboundLowWatermark,
         socketReceiveBufferSize: socketReceiveBufferSize ?? this.socketReceiveBufferSize,
         socketSendBufferSize: socketSendBufferSize ?? this.socketSendBufferSize,
         socketNonblock: socketNonblock ?? this.socketNonblock,
@@ -98,6 +114,7 @@ class TransportTcpClientConfiguration {
         tcpQuickack: tcpQuickack ?? this.tcpQuickack,
         tcpDeferAccept: tcpDeferAccept ?? this.tcpDeferAccept,
         tcpFastopen: tcpFastopen ?? this.tcpFastopen,
+        tcpFastopenConnect: tcpFastopenConnect ?? this.tcpFastopenConnect,
         tcpKeepAliveIdle: tcpKeepAliveIdle ?? this.tcpKeepAliveIdle,
         tcpKeepAliveMaxCount: tcpKeepAliveMaxCount ?? this.tcpKeepAliveMaxCount,
         tcpKeepAliveIndividualCount: tcpKeepAliveIndividualCount ?? this.tcpKeepAliveIndividualCount,
@@ -125,6 +142,8 @@ class TransportUdpClientConfiguration {
   final TransportUdpMulticastConfiguration? ipMulticastInterface;
   final int? ipMulticastLoop;
   final int? ipMulticastTtl;
+  final bool? udpGro;
+  final bool? socketTimestamping;
   final TransportUdpMulticastManager? multicastManager;
 
   TransportUdpClientConfiguration({
@@ -145,6 +164,8 @@ class TransportUdpClientConfiguration {
     this.ipMulticastInterface,
     this.ipMulticastLoop,
     this.ipMulticastTtl,
+    this.udpGro,
+    this.socketTimestamping,
     this.multicastManager,
   });
 
@@ -166,6 +187,8 @@ class TransportUdpClientConfiguration {
     TransportUdpMulticastConfiguration? ipMulticastInterface,
     int? ipMulticastLoop,
     int? ipMulticastTtl,
+    bool? udpGro,
+    bool? socketTimestamping,
     TransportUdpMulticastManager? multicastManager,
   }) =>
       TransportUdpClientConfiguration(
@@ -186,15 +209,20 @@ class TransportUdpClientConfiguration {
         ipMulticastInterface: ipMulticastInterface ?? this.ipMulticastInterface,
         ipMulticastLoop: ipMulticastLoop ?? this.ipMulticastLoop,
         ipMulticastTtl: ipMulticastTtl ?? this.ipMulticastTtl,
+        udpGro: udpGro ?? this.udpGro,
+        socketTimestamping: socketTimestamping ?? this.socketTimestamping,
         multicastManager: multicastManager ?? this.multicastManager,
       );
 }
 
 class TransportUnixStreamClientConfiguration {
   final int pool;
+  final TransportClientSelection? selection;
   final Duration? connectTimeout;
   final Duration? readTimeout;
   final Duration? writeTimeout;
+  final int? outboundHighWatermark;
+  final int? outboundLowWatermark;
   final int? socketReceiveBufferSize;
   final int? socketSendBufferSize;
   final bool? socketNonblock;
@@ -205,9 +233,12 @@ class TransportUnixStreamClientConfiguration {
 
   TransportUnixStreamClientConfiguration({
     required this.pool,
+    this.selection,
     this.connectTimeout,
     this.readTimeout,
     this.writeTimeout,
+    this.outboundHighWatermark,
+    this.outboundLowWatermark,
     this.socketReceiveBufferSize,
     this.socketSendBufferSize,
     this.socketNonblock,
@@ -219,9 +250,12 @@ class TransportUnixStreamClientConfiguration {
 
   TransportUnixStreamClientConfiguration copyWith({
     int? pool,
+    TransportClientSelection? selection,
     Duration? connectTimeout,
     Duration? readTimeout,
     Duration? writeTimeout,
+    int? outboundHighWatermark,
+    int? outboundLowWatermark,
     int? socketReceiveBufferSize,
     int? socketSendBufferSize,
     bool? socketNonblock,
@@ -231,9 +265,12 @@ class TransportUnixStreamClientConfiguration {
   }) =>
       TransportUnixStreamClientConfiguration(
         pool: pool ?? this.pool,
+        selection: selection ?? this.selection,
         connectTimeout: connectTimeout ?? this.connectTimeout,
         readTimeout: readTimeout ?? this.readTimeout,
         writeTimeout: writeTimeout ?? this.writeTimeout,
+        outboundHighWatermark: outboundHighWatermark ?? this.outboundHighWatermark,
+        outboundLowWatermark: outboundLowWatermark ?? this.outboundLowWatermark,
         socketReceiveBufferSize: socketReceiveBufferSize ?? this.socketReceiveBufferSize,
         socketSendBufferSize: socketSendBufferSize ?? this.socketSendBufferSize,
         socketNonblock: socketNonblock ?? this.socketNonblock,
@@ -243,3 +280,47 @@ class TransportUnixStreamClientConfiguration {
         socketSendLowAt: socketSendLowAt ?? this.socketSendLowAt,
       );
 }
+}
+
+class TransportUnixDatagramClientConfiguration {
+  final Duration? readTimeout;
+  final Duration? writeTimeout;
+  final int? socketReceiveBufferSize;
+  final int? socketSendBufferSize;
+  final bool? socketNonblock;
+  final bool? socketCloexec;
+  final int? socketReceiveLowAt;
+  final int? socketSendLowAt;
+
+  TransportUnixDatagramClientConfiguration({
+    this.readTimeout,
+    this.writeTimeout,
+    this.socketReceiveBufferSize,
+    this.socketSendBufferSize,
+    this.socketNonblock,
+    this.socketCloexec,
+    this.socketReceiveLowAt,
+    this.socketSendLowAt,
+  });
+
+  TransportUnixDatagramClientConfiguration copyWith({
+    Duration? readTimeout,
+    Duration? writeTimeout,
+    int? socketReceiveBufferSize,
+    int? socketSendBufferSize,
+    bool? socketNonblock,
+    bool? socketCloexec,
+    int? socketReceiveLowAt,
+    int? socketSendLowAt,
+  }) =>
+      TransportUnixDatagramClientConfiguration(
+        readTimeout: readTimeout ?? this.readTimeout,
+        writeTimeout: writeTimeout ?? this.writeTimeout,
+        socketReceiveBufferSize: socketReceiveBufferSize ?? this.socketReceiveBufferSize,
+        socketSendBufferSize: socketSendBufferSize ?? this.socketSendBufferSize,
+        socketNonblock: socketNonblock ?? this.socketNonblock,
+        socketCloexec: socketCloexec ?? this.socketCloexec,
+        socketReceiveLowAt: socketReceiveLowAt ?? this.socketReceiveLowAt,
+        socketSendLowAt: socketSendLowAt ?? this.socketSendLowAt,
+      );
+}
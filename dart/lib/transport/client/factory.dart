@@ -1,6 +1,7 @@
 import 'dart:async';
 import 'dart:ffi';
 import 'dart:io';
+import 'dart:typed_data';
 
 import 'package:ffi/ffi.dart';
 
@@ -12,6 +13,7 @@ import '../constants.dart';
 import '../defaults.dart';
 import '../exception.dart';
 import '../payload.dart';
+import '../watermarks.dart';
 import 'client.dart';
 import 'provider.dart';
 import 'configuration.dart';
@@ -32,23 +34,96 @@ class TransportClientsFactory {
     InternetAddress address,
     int port, {
     TransportTcpClientConfiguration? configuration,
+    Uint8List? data,
   }) async {
     configuration = configuration ?? TransportDefaults.tcpClient();
+    final clientPointers = _workerPointer.ref.ring_sockets ? await _tcpSockets(address, port, configuration) : _tcpDescriptors(address, port, configuration);
     final clients = <Future<TransportClientConnection>>[];
+    for (var clientPointer in clientPointers) {
+      final client = TransportClientChannel(
+        TransportChannel(
+          _workerPointer,
+          clientPointer.ref.fd,
+          _bindings,
+          _buffers,
+        ),
+        clientPointer,
+        _workerPointer,
+        _bindings,
+        configuration.readTimeout?.inSeconds,
+        configuration.writeTimeout?.inSeconds,
+        _buffers,
+        _registry,
+        _payloadPool,
+        connectTimeout: configuration.connectTimeout?.inSeconds,
+        latencyTracking: configuration.selection == TransportClientSelection.powerOfTwoChoices,
+        watermarks: TransportOutboundWatermarks(configuration.outboundHighWatermark, configuration.outboundLowWatermark),
+      );
+      _registry.add(clientPointer.ref.fd, client);
+      clients.add((data == null ? client.connect() : client.connectWithData(data)).then(TransportClientConnection.new));
+    }
+    final selection = configuration.selection ?? TransportClientSelection.roundRobin;
+    return Future.wait(clients).then((clients) => TransportClientConnectionPool(clients, selection: selection));
+  }
+
+  Future<List<Pointer<transport_client_t>>> _tcpSockets(InternetAddress address, int port, TransportTcpClientConfiguration configuration) async {
+    final clientPointers = <Pointer<transport_client_t>>[];
+    using((arena) {
+      final nativeConfiguration = _tcpConfiguration(configuration, arena);
+      final ip = address.address.toNativeUtf8(allocator: arena).cast<Char>();
+      for (var clientIndex = 0; clientIndex < configuration.pool; clientIndex++) {
+        final clientPointer = calloc<transport_client_t>();
+        if (clientPointer == nullptr) {
+          _releaseClients(clientPointers);
+          throw TransportInitializationException(TransportMessages.clientMemoryError);
+        }
+        _bindings.transport_client_prepare_tcp(clientPointer, nativeConfiguration, ip, port);
+        clientPointers.add(clientPointer);
+      }
+    });
+    final sockets = <Future<int>>[];
+    for (var clientPointer in clientPointers) {
+      sockets.add(_registry.socket((slot) => _bindings.transport_worker_socket(_workerPointer, clientPointer, slot)));
+    }
+    final descriptors = await Future.wait(sockets);
+    TransportInitializationException? failure;
+    for (var clientIndex = 0; clientIndex < clientPointers.length; clientIndex++) {
+      final descriptor = descriptors[clientIndex];
+      clientPointers[clientIndex].ref.fd = descriptor;
+      if (failure != null) continue;
+      if (descriptor < 0) {
+        failure = TransportInitializationException(TransportMessages.clientError(descriptor, _bindings));
+        continue;
+      }
+      if (_workerPointer.ref.ring_socket_options) continue;
+      final result = _bindings.transport_client_apply_options(clientPointers[clientIndex]);
+      if (result < 0) failure = TransportInitializationException(TransportMessages.clientSocketError(result));
+    }
+    if (failure != null) {
+      _releaseClients(clientPointers);
+      throw failure;
+    }
+    return clientPointers;
+  }
+
+  List<Pointer<transport_client_t>> _tcpDescriptors(InternetAddress address, int port, TransportTcpClientConfiguration configuration) {
+    final clientPointers = <Pointer<transport_client_t>>[];
     for (var clientIndex = 0; clientIndex < configuration.pool; clientIndex++) {
       final clientPointer = calloc<transport_client_t>();
       if (clientPointer == nullptr) {
+        _releaseClients(clientPointers);
         throw TransportInitializationException(TransportMessages.clientMemoryError);
       }
       final result = using(
         (arena) => _bindings.transport_client_initialize_tcp(
           clientPointer,
-          _tcpConfiguration(configuration!, arena),
+          _tcpConfiguration(configuration, arena),
           address.address.toNativeUtf8(allocator: arena).cast(),
           port,
         ),
       );
       if (result < 0) {
+        _releaseClients(clientPointers);
         if (clientPointer.ref.fd > 0) {
           _bindings.transport_close_descriptor(clientPointer.ref.fd);
           calloc.free(clientPointer);
@@ -57,27 +132,16 @@ class TransportClientsFactory {
         calloc.free(clientPointer);
         throw TransportInitializationException(TransportMessages.clientSocketError(result));
       }
-      final client = TransportClientChannel(
-        TransportChannel(
-          _workerPointer,
-          clientPointer.ref.fd,
-          _bindings,
-          _buffers,
-        ),
-        clientPointer,
-        _workerPointer,
-        _bindings,
-        configuration.readTimeout?.inSeconds,
-        configuration.writeTimeout?.inSeconds,
-        _buffers,
-        _registry,
-        _payloadPool,
-        connectTimeout: configuration.connectTimeout?.inSeconds,
-      );
-      _registry.add(clientPointer.ref.fd, client);
-      clients.add(client.connect().then(TransportClientConnection.new));
+      clientPointers.add(clientPointer);
+    }
+    return clientPointers;
+  }
+
+  void _releaseClients(List<Pointer<transport_client_t>> clientPointers) {
+    for (var clientPointer in clientPointers) {
+      if (clientPointer.ref.fd >= 0) _bindings.transport_close_descriptor(clientPointer.ref.fd);
+      calloc.free(clientPointer);
     }
-    return Future.wait(clients).then(TransportClientConnectionPool.new);
   }
 
   TransportDatagramClient udp(
@@ -163,16 +227,79 @@ class TransportClientsFactory {
       _buffers,
       _registry,
       _payloadPool,
+      timestamps: configuration.socketTimestamping == true,
     );
     _registry.add(clientPointer.ref.fd, client);
     return TransportDatagramClient(client);
   }
 
+  @pragma(preferInlinePragma)
   Future<TransportClientConnectionPool> unixStream(
     String path, {
     TransportUnixStreamClientConfiguration? configuration,
-  }) async {
-    configuration = configuration ?? TransportDefaults.unixStreamClient();
+  }) =>
+      _unixConnections(path, configuration ?? TransportDefaults.unixStreamClient(), _bindings.transport_client_initialize_unix_stream);
+
+  @pragma(preferInlinePragma)
+  Future<TransportClientConnectionPool> unixSeqpacket(
+    String path, {
+    TransportUnixStreamClientConfiguration? configuration,
+  }) =>
+      _unixConnections(path, configuration ?? TransportDefaults.unixStreamClient(), _bindings.transport_client_initialize_unix_seqpacket);
+
+  TransportDatagramClient unixDatagram(
+    String sourcePath,
+    String destinationPath, {
+    TransportUnixDatagramClientConfiguration? configuration,
+  }) {
+    configuration = configuration ?? TransportDefaults.unixDatagramClient();
+    final clientPointer = using((arena) {
+      final pointer = calloc<transport_client_t>();
+      if (pointer == nullptr) {
+        throw TransportInitializationException(TransportMessages.clientMemoryError);
+      }
+      final result = _bindings.transport_client_initialize_unix_datagram(
+        pointer,
+        _unixDatagramConfiguration(configuration!, arena),
+        destinationPath.toNativeUtf8(allocator: arena).cast(),
+        sourcePath.toNativeUtf8(allocator: arena).cast(),
+      );
+      if (result < 0) {
+        if (pointer.ref.fd > 0) {
+          _bindings.transport_close_descriptor(pointer.ref.fd);
+          calloc.free(pointer);
+          throw TransportInitializationException(TransportMessages.clientError(result, _bindings));
+        }
+        calloc.free(pointer);
+        throw TransportInitializationException(TransportMessages.clientSocketError(result));
+      }
+      return pointer;
+    });
+    final client = TransportClientChannel(
+      TransportChannel(
+        _workerPointer,
+        clientPointer.ref.fd,
+        _bindings,
+        _buffers,
+      ),
+      clientPointer,
+      _workerPointer,
+      _bindings,
+      configuration.readTimeout?.inSeconds,
+      configuration.writeTimeout?.inSeconds,
+      _buffers,
+      _registry,
+      _payloadPool,
+    );
+    _registry.add(clientPointer.ref.fd, client);
+    return TransportDatagramClient(client);
+  }
+
+  Future<TransportClientConnectionPool> _unixConnections(
+    String path,
+    TransportUnixStreamClientConfiguration configuration,
+    int Function(Pointer<transport_client_t> client, Pointer<transport_client_configuration_t> configuration, Pointer<Char> path) initialize,
+  ) async {
     final clients = <Future<TransportClientConnection>>[];
     for (var clientIndex = 0; clientIndex < configuration.pool; clientIndex++) {
       final clientPointer = calloc<transport_client_t>();
@@ -180,9 +307,9 @@ class TransportClientsFactory {
         throw TransportInitializationException(TransportMessages.clientMemoryError);
       }
       final result = using(
-        (arena) => _bindings.transport_client_initialize_unix_stream(
+        (arena) => initialize(
           clientPointer,
-          _unixStreamConfiguration(configuration!, arena),
+          _unixStreamConfiguration(configuration, arena),
           path.toNativeUtf8(allocator: arena).cast(),
         ),
       );
@@ -212,16 +339,21 @@ class TransportClientsFactory {
         _registry,
         _payloadPool,
         connectTimeout: configuration.connectTimeout?.inSeconds,
+        latencyTracking: configuration.selection == TransportClientSelection.powerOfTwoChoices,
+        watermarks: TransportOutboundWatermarks(configuration.outboundHighWatermark, configuration.outboundLowWatermark),
       );
       _registry.add(clientPointer.ref.fd, client);
       clients.add(client.connect().then(TransportClientConnection.new, onError: (error, stackTrace) {
-        channel.close();
         _registry.remove(clientPointer.ref.fd);
+        channel.close();
         _bindings.transport_client_destroy(clientPointer);
         throw error;
       }));
     }
-    return TransportClientConnectionPool(await Future.wait(clients));
+    return TransportClientConnectionPool(
+      await Future.wait(clients),
+      selection: configuration.selection ?? TransportClientSelection.roundRobin,
+    );
   }
 
   Pointer<transport_client_configuration_t> _tcpConfiguration(TransportTcpClientConfiguration clientConfiguration, Allocator allocator) {
@@ -236,6 +368,7 @@ class TransportClientsFactory {
     if (clientConfiguration.tcpQuickack == true) flags |= transportSocketOptionTcpQuickack;
     if (clientConfiguration.tcpDeferAccept == true) flags |= transportSocketOptionTcpDeferAccept;
     if (clientConfiguration.tcpFastopen == true) flags |= transportSocketOptionTcpFastopen;
+    if (clientConfiguration.tcpFastopenConnect == true) flags |= transportSocketOptionTcpFastopenConnect;
     if (clientConfiguration.socketReceiveBufferSize != null) {
       flags |= transportSocketOptionSocketRcvbuf;
       nativeClientConfiguration.ref.socket_receive_buffer_size = clientConfiguration.socketReceiveBufferSize!;
@@ -291,6 +424,8 @@ class TransportClientsFactory {
     if (clientConfiguration.ipFreebind == true) flags |= transportSocketOptionIpFreebind;
     if (clientConfiguration.ipMulticastAll == true) flags |= transportSocketOptionIpMulticastAll;
     if (clientConfiguration.ipMulticastLoop == true) flags |= transportSocketOptionIpMulticastLoop;
+    if (clientConfiguration.udpGro == true) flags |= transportSocketOptionUdpGro;
+    if (clientConfiguration.socketTimestamping == true) flags |= transportSocketOptionSocketTimestamping;
     if (clientConfiguration.socketReceiveBufferSize != null) {
       flags |= transportSocketOptionSocketRcvbuf;
       nativeClientConfiguration.ref.socket_receive_buffer_size = clientConfiguration.socketReceiveBufferSize!;
@@ -356,6 +491,31 @@ class TransportClientsFactory {
     return nativeClientConfiguration;
   }
 
+  Pointer<transport_client_configuration_t> _unixDatagramConfiguration(TransportUnixDatagramClientConfiguration clientConfiguration, Allocator allocator) {
+    final nativeClientConfiguration = allocator<transport_client_configuration_t>();
+    var flags = 0;
+    if (clientConfiguration.socketNonblock == true) flags |= transportSocketOptionSocketNonblock;
+    if (clientConfiguration.socketCloexec == true) flags |= transportSocketOptionSocketCloexec;
+    if (clientConfiguration.socketReceiveBufferSize != null) {
+      flags |= transportSocketOptionSocketRcvbuf;
+      nativeClientConfiguration.ref.socket_receive_buffer_size = clientConfiguration.socketReceiveBufferSize!;
+    }
+    if (clientConfiguration.socketSendBufferSize != null) {
+      flags |= transportSocketOptionSocketSndbuf;
+      nativeClientConfiguration.ref.socket_send_buffer_size = clientConfiguration.socketSendBufferSize!;
+    }
+    if (clientConfiguration.socketReceiveLowAt != null) {
+      flags |= transportSocketOptionSocketRcvlowat;
+      nativeClientConfiguration.ref.socket_receive_low_at = clientConfiguration.socketReceiveLowAt!;
+    }
+    if (clientConfiguration.socketSendLowAt != null) {
+      flags |= transportSocketOptionSocketSndlowat;
+      nativeClientConfiguration.ref.socket_send_low_at = clientConfiguration.socketSendLowAt!;
+    }
+    nativeClientConfiguration.ref.socket_configuration_flags = flags;
+    return nativeClientConfiguration;
+  }
+
   int _getMembershipIndex(TransportUdpMulticastConfiguration configuration) => using(
         (arena) {
           if (configuration.calculateInterfaceIndex) {
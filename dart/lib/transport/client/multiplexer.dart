@@ -0,0 +1,98 @@
+import 'dart:async';
+import 'dart:typed_data';
+
+import '../constants.dart';
+import '../exception.dart';
+import '../frame.dart';
+import 'client.dart';
+import 'provider.dart';
+
+class _TransportMultiplexedCall {
+  final TransportClientConnection connection;
+  final completer = Completer<Uint8List>();
+  Timer? timer;
+
+  _TransportMultiplexedCall(this.connection);
+}
+
+class TransportMultiplexedClient {
+  final TransportClientConnectionPool _pool;
+  final Duration? _deadline;
+  final _calls = <int, _TransportMultiplexedCall>{};
+
+  var _nextId = 0;
+  var _closing = false;
+
+  int get inflight => _calls.length;
+  bool get active => !_closing;
+
+  TransportMultiplexedClient(this._pool, this._deadline) {
+    _pool.forEach((connection) {
+      final decoder = TransportFrameDecoder(
+        _complete,
+        (error) {
+          _failConnection(connection, error);
+          unawaited(connection.close());
+        },
+        maxFrameLength: connection.bufferSize,
+      );
+      connection.stream().listen(
+        (payload) {
+          decoder.add(payload.bytes);
+          payload.release();
+        },
+        onError: (error) => _failConnection(connection, error as Exception),
+        onDone: () => _failConnection(connection, TransportClosedException.forClient()),
+      );
+    });
+  }
+
+  Future<Uint8List> call(Uint8List request, {Duration? deadline}) {
+    if (_closing) return Future.error(TransportClosedException.forClient());
+    final connection = _pool.select();
+    if (transportFrameHeaderSize + request.length > connection.bufferSize) {
+      return Future.error(TransportFrameLengthException(transportFrameHeaderSize + request.length, connection.bufferSize));
+    }
+    final id = _nextId++;
+    final call = _TransportMultiplexedCall(connection);
+    _calls[id] = call;
+    deadline = deadline ?? _deadline;
+    if (deadline != null) call.timer = Timer(deadline, () => _fail(id, TransportDeadlineException(id, deadline!)));
+    call.connection.writeSingle(encodeTransportFrame(id, request), onError: (error) => _fail(id, error));
+    return call.completer.future;
+  }
+
+  Future<void> close({Duration? gracefulTimeout}) async {
+    _closing = true;
+    if (gracefulTimeout != null && _calls.isNotEmpty) {
+      await Future.wait(_calls.values.map((call) => call.completer.future.then((_) {}, onError: (_) {}))).timeout(gracefulTimeout, onTimeout: () => []);
+    }
+    for (var id in _calls.keys.toList()) {
+      _fail(id, TransportClosedException.forClient());
+    }
+    await _pool.close(gracefulTimeout: gracefulTimeout);
+  }
+
+  @pragma(preferInlinePragma)
+  void _complete(int id, Uint8List response) {
+    final call = _calls.remove(id);
+    if (call == null) return;
+    call.timer?.cancel();
+    call.completer.complete(response);
+  }
+
+  @pragma(preferInlinePragma)
+  void _fail(int id, Exception error) {
+    final call = _calls.remove(id);
+    if (call == null) return;
+    call.timer?.cancel();
+    call.completer.completeError(error);
+  }
+
+  void _failConnection(TransportClientConnection connection, Exception error) {
+    final ids = _calls.entries.where((entry) => identical(entry.value.connection, connection)).map((entry) => entry.key).toList();
+    for (var id in ids) {
+      _fail(id, error);
+    }
+  }
+}
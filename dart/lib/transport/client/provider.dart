@@ -1,6 +1,7 @@
 import 'dart:async';
 import 'dart:typed_data';
 
+import '../configuration.dart';
 import '../constants.dart';
 import '../payload.dart';
 import 'client.dart';
@@ -11,6 +12,11 @@ class TransportClientConnection {
   const TransportClientConnection(this._client);
 
   bool get active => _client.active;
+  bool get writable => _client.writable;
+  int get outbound => _client.outbound;
+  int get pending => _client.pending;
+  int get latency => _client.latency;
+  int get bufferSize => _client.bufferSize;
   Stream<TransportPayload> get inbound => _client.inbound;
 
   Future<void> read() => _client.read();
@@ -18,11 +24,16 @@ class TransportClientConnection {
   @pragma(preferInlinePragma)
   Stream<TransportPayload> stream() {
     final out = StreamController<TransportPayload>(sync: true);
-    out.onListen = () => unawaited(_client.read().onError((error, stackTrace) => out.addError(error!)));
+    void read() {
+      if (_client.tryRead()) return;
+      unawaited(_client.read().onError((error, stackTrace) => out.addError(error!)));
+    }
+
+    out.onListen = read;
     _client.inbound.listen(
       (event) {
         out.add(event);
-        if (_client.active) unawaited(_client.read().onError((error, stackTrace) => out.addError(error!)));
+        if (_client.active) read();
       },
       onDone: out.close,
       onError: out.addError,
@@ -30,8 +41,12 @@ class TransportClientConnection {
     return out.stream;
   }
 
+  @pragma(preferInlinePragma)
+  Future<void> whenWritable() => _client.whenWritable();
+
   @pragma(preferInlinePragma)
   void writeSingle(Uint8List bytes, {void Function(Exception error)? onError, void Function()? onDone}) {
+    if (_client.tryWriteSingle(bytes, onError: onError, onDone: onDone)) return;
     unawaited(_client.writeSingle(bytes, onError: onError, onDone: onDone).onError((error, stackTrace) => onError?.call(error as Exception)));
   }
 
@@ -46,6 +61,9 @@ class TransportClientConnection {
     }).onError((error, stackTrace) => onError?.call(error as Exception)));
   }
 
+  @pragma(preferInlinePragma)
+  void enableTls({required TransportTlsKeys transmit, TransportTlsKeys? receive}) => _client.enableTls(transmit, receive);
+
   @pragma(preferInlinePragma)
   Future<void> close({Duration? gracefulTimeout}) => _client.close(gracefulTimeout: gracefulTimeout);
 }
@@ -94,12 +112,13 @@ class TransportDatagramClient {
     List<Uint8List> bytes, {
     int? flags,
     bool linked = false,
+    bool segmented = false,
     void Function(Exception error)? onError,
     void Function()? onDone,
   }) {
     var doneCounter = 0;
     var errorCounter = 0;
-    unawaited(_client.sendMany(bytes, flags: flags, linked: linked, onError: (error) {
+    unawaited(_client.sendMany(bytes, flags: flags, linked: linked, segmented: segmented, onError: (error) {
       if (++errorCounter + doneCounter == bytes.length) onError?.call(error);
     }, onDone: () {
       if (errorCounter == 0 && ++doneCounter == bytes.length) onDone?.call();
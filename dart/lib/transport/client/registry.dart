@@ -1,21 +1,45 @@
+import 'dart:async';
+
 import 'package:meta/meta.dart';
 
 import '../constants.dart';
+import '../handles.dart';
 import 'client.dart';
 
 class TransportClientRegistry {
   final _clients = <int, TransportClientChannel>{};
+  final _sockets = <int, Completer<int>>{};
+  final TransportHandles _handles;
+  var _nextSocket = 0;
+
+  TransportClientRegistry(this._handles);
 
-  TransportClientRegistry();
+  @pragma(preferInlinePragma)
+  TransportClientChannel? get(int handle) => _handles.get<TransportClientChannel>(handle);
 
   @pragma(preferInlinePragma)
-  TransportClientChannel? get(int fd) => _clients[fd];
+  void remove(int fd) {
+    final channel = _clients.remove(fd);
+    if (channel != null) _handles.remove(fd, channel);
+  }
 
   @pragma(preferInlinePragma)
-  void remove(int fd) => _clients.remove(fd);
+  void add(int fd, TransportClientChannel channel) {
+    _handles.add(fd, channel);
+    _clients[fd] = channel;
+  }
+
+  Future<int> socket(void Function(int slot) submit) {
+    final slot = _nextSocket;
+    final completer = Completer<int>();
+    _nextSocket = (_nextSocket + 1) & 0xffffffff;
+    _sockets[slot] = completer;
+    submit(slot);
+    return completer.future;
+  }
 
   @pragma(preferInlinePragma)
-  void add(int fd, TransportClientChannel channel) => _clients[fd] = channel;
+  void notifySocket(int slot, int result) => _sockets.remove(slot)?.complete(result);
 
   @pragma(preferInlinePragma)
   Future<void> close({Duration? gracefulTimeout}) => Future.wait(_clients.values.toList().map((client) => client.close(gracefulTimeout: gracefulTimeout)));
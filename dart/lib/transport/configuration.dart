@@ -1,3 +1,7 @@
+import 'dart:typed_data';
+
+import 'constants.dart';
+
 const ringSetupIopoll = 1 << 0;
 const ringSetupSqpoll = 1 << 1;
 const ringSetupSqAff = 1 << 2;
@@ -15,6 +19,9 @@ const ringSetupDeferTaskrun = 1 << 13;
 
 class TransportWorkerConfiguration {
   final int buffersCount;
+  final int buffersMaxCount;
+  final double buffersGrowOccupancy;
+  final double buffersShrinkOccupancy;
   final int bufferSize;
   final int ringSize;
   final int ringFlags;
@@ -26,9 +33,13 @@ class TransportWorkerConfiguration {
   final Duration baseDelay;
   final Duration maxDelay;
   final bool trace;
+  final int traceCapacity;
 
   TransportWorkerConfiguration({
     required this.buffersCount,
+    required this.buffersMaxCount,
+    required this.buffersGrowOccupancy,
+    required this.buffersShrinkOccupancy,
     required this.bufferSize,
     required this.ringSize,
     required this.ringFlags,
@@ -40,10 +51,14 @@ class TransportWorkerConfiguration {
     required this.cqeWaitCount,
     required this.cqeWaitTimeout,
     required this.trace,
+    required this.traceCapacity,
   });
 
   TransportWorkerConfiguration copyWith({
     int? buffersCount,
+    int? buffersMaxCount,
+    double? buffersGrowOccupancy,
+    double? buffersShrinkOccupancy,
     int? bufferSize,
     int? ringSize,
     int? ringFlags,
@@ -55,9 +70,13 @@ class TransportWorkerConfiguration {
     int? cqeWaitCount,
     Duration? cqeWaitTimeout,
     bool? trace,
+    int? traceCapacity,
   }) =>
       TransportWorkerConfiguration(
         buffersCount: buffersCount ?? this.buffersCount,
+        buffersMaxCount: buffersMaxCount ?? this.buffersMaxCount,
+        buffersGrowOccupancy: buffersGrowOccupancy ?? this.buffersGrowOccupancy,
+        buffersShrinkOccupancy: buffersShrinkOccupancy ?? this.buffersShrinkOccupancy,
         bufferSize: bufferSize ?? this.bufferSize,
         ringSize: ringSize ?? this.ringSize,
         ringFlags: ringFlags ?? this.ringFlags,
@@ -69,6 +88,7 @@ class TransportWorkerConfiguration {
         cqeWaitCount: cqeWaitCount ?? this.cqeWaitCount,
         cqeWaitTimeout: cqeWaitTimeout ?? this.cqeWaitTimeout,
         trace: trace ?? this.trace,
+        traceCapacity: traceCapacity ?? this.traceCapacity,
       );
 }
 
@@ -140,4 +160,22 @@ class TransportUdpMulticastManager {
   void addSourceMembership(TransportUdpMulticastSourceConfiguration configuration) => _onAddSourceMembership(configuration);
 
   void dropSourceMembership(TransportUdpMulticastSourceConfiguration configuration) => _onDropSourceMembership(configuration);
-}
\ No newline at end of file
+}
+
+class TransportTlsKeys {
+  final TransportTlsVersion version;
+  final TransportTlsCipher cipher;
+  final Uint8List key;
+  final Uint8List iv;
+  final Uint8List salt;
+  final Uint8List sequence;
+
+  TransportTlsKeys({
+    required this.version,
+    required this.cipher,
+    required this.key,
+    required this.iv,
+    required this.salt,
+    required this.sequence,
+  });
+}
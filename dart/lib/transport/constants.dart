@@ -48,6 +48,8 @@ class TransportPackageConfigFields {
 }
 
 const transportBufferUsed = -1;
+const transportBuffersMaxCount = TRANSPORT_WORKER_BUFFERS_LIMIT;
+const transportMessagesQueueCapacity = 1024;
 
 const transportEventRead = 1 << 0;
 const transportEventWrite = 1 << 1;
@@ -58,6 +60,12 @@ const transportEventConnect = 1 << 5;
 const transportEventClient = 1 << 6;
 const transportEventFile = 1 << 7;
 const transportEventServer = 1 << 8;
+const transportEventSync = 1 << 9;
+const transportEventAllocate = 1 << 10;
+const transportEventAdvise = 1 << 11;
+const transportEventMessage = 1 << 12;
+const transportEventShared = 1 << 13;
+const transportEventSocket = 1 << 14;
 
 const transportEventAll = transportEventRead |
     transportEventWrite |
@@ -67,7 +75,13 @@ const transportEventAll = transportEventRead |
     transportEventSendMessage |
     transportEventClient |
     transportEventFile |
-    transportEventServer;
+    transportEventServer |
+    transportEventSync |
+    transportEventAllocate |
+    transportEventAdvise |
+    transportEventMessage |
+    transportEventShared |
+    transportEventSocket;
 
 const transportSocketOptionSocketNonblock = 1 << 1;
 const transportSocketOptionSocketCloexec = 1 << 2;
@@ -98,9 +112,17 @@ const transportSocketOptionTcpKeepintvl = 1 << 26;
 const transportSocketOptionTcpMaxseg = 1 << 27;
 const transportSocketOptionTcpNoDelay = 1 << 28;
 const transportSocketOptionTcpSyncnt = 1 << 29;
+const transportSocketOptionUdpGro = 1 << 30;
+const transportSocketOptionSocketTimestamping = 1 << 31;
+const transportSocketOptionTcpFastopenConnect = 1 << 32;
 
 const transportTimeoutInfinity = -1;
+const transportUdpMaxSegments = 64;
+const transportTlsSequenceLength = 8;
 const transportParentRingNone = -1;
+const transportHandleIndexBits = 24;
+const transportHandleIndexMask = (1 << transportHandleIndexBits) - 1;
+const transportHandleGenerationMask = 0xff;
 
 const transportIosqeFixedFile = 1 << 0;
 const transportIosqeIoDrain = 1 << 1;
@@ -110,6 +132,8 @@ const transportIosqeAsync = 1 << 4;
 const transportIosqeBufferSelect = 1 << 5;
 const transportIosqeCqeSkipSuccess = 1 << 6;
 
+const transportFileAllocateKeepSize = 1 << 0;
+
 enum TransportDatagramMessageFlag {
   oob(0x01),
   peek(0x02),
@@ -152,6 +176,14 @@ enum TransportEvent {
   clientSend,
   fileRead,
   fileWrite,
+  fileSync,
+  fileAllocate,
+  fileAdvise,
+  message,
+  handOff,
+  sharedConnect,
+  sharedRead,
+  sharedWrite,
   unknown;
 
   static TransportEvent serverEvent(int event) {
@@ -166,6 +198,9 @@ enum TransportEvent {
   static TransportEvent fileEvent(int event) {
     if (event == transportEventRead) return TransportEvent.fileRead;
     if (event == transportEventWrite) return TransportEvent.fileWrite;
+    if (event == transportEventSync) return TransportEvent.fileSync;
+    if (event == transportEventAllocate) return TransportEvent.fileAllocate;
+    if (event == transportEventAdvise) return TransportEvent.fileAdvise;
     return TransportEvent.unknown;
   }
 
@@ -178,6 +213,13 @@ enum TransportEvent {
     return TransportEvent.unknown;
   }
 
+  static TransportEvent sharedEvent(int event) {
+    if (event == transportEventRead) return TransportEvent.sharedRead;
+    if (event == transportEventWrite) return TransportEvent.sharedWrite;
+    if (event == transportEventReceiveMessage) return TransportEvent.sharedConnect;
+    return TransportEvent.unknown;
+  }
+
   @override
   String toString() => name;
 }
@@ -194,12 +236,77 @@ enum TransportFileMode {
   const TransportFileMode(this.mode);
 }
 
+enum TransportFileAdvice {
+  normal(0),
+  random(1),
+  sequential(2),
+  willNeed(3),
+  dontNeed(4);
+
+  final int advice;
+
+  const TransportFileAdvice(this.advice);
+}
+
+enum TransportOperation {
+  read(transport_operation.TRANSPORT_OPERATION_READ),
+  write(transport_operation.TRANSPORT_OPERATION_WRITE),
+  receiveMessage(transport_operation.TRANSPORT_OPERATION_RECEIVE_MESSAGE),
+  sendMessage(transport_operation.TRANSPORT_OPERATION_SEND_MESSAGE),
+  connect(transport_operation.TRANSPORT_OPERATION_CONNECT),
+  accept(transport_operation.TRANSPORT_OPERATION_ACCEPT),
+  file(transport_operation.TRANSPORT_OPERATION_FILE);
+
+  final int operation;
+
+  const TransportOperation(this.operation);
+}
+
+enum TransportTraceKind {
+  submit(transport_trace_kind.TRANSPORT_TRACE_SUBMIT),
+  complete(transport_trace_kind.TRANSPORT_TRACE_COMPLETE),
+  cancel(transport_trace_kind.TRANSPORT_TRACE_CANCEL);
+
+  final int kind;
+
+  const TransportTraceKind(this.kind);
+}
+
+enum TransportClientSelection {
+  roundRobin,
+  leastOutstanding,
+  powerOfTwoChoices,
+}
+
+enum TransportTlsVersion {
+  tls12(0x0303),
+  tls13(0x0304);
+
+  final int version;
+
+  const TransportTlsVersion(this.version);
+}
+
+enum TransportTlsCipher {
+  aesGcm128(51, 16, 8, 4),
+  aesGcm256(52, 32, 8, 4),
+  chacha20Poly1305(54, 32, 12, 0);
+
+  final int cipher;
+  final int keyLength;
+  final int ivLength;
+  final int saltLength;
+
+  const TransportTlsCipher(this.cipher, this.keyLength, this.ivLength, this.saltLength);
+}
+
 class TransportMessages {
   TransportMessages._();
 
   static final workerMemoryError = "[worker] out of memory";
   static workerError(int result, TransportBindings bindings) => "[worker] code = $result, message = ${_kernelErrorToString(result, bindings)}";
-  static workerTrace(int id, int result, int data, int fd) => "worker = $id, result = $result,  bid = ${((data >> 16) & 0xffff)}, fd = $fd";
+  static workerTrace(TransportTraceKind kind, int timestamp, int result, int event, int bufferId, int fd) =>
+      "[worker] ${kind.name}, timestamp = $timestamp, result = $result, event = $event, bid = $bufferId, fd = $fd";
 
   static final serverMemoryError = "[server] out of memory";
   static final serverClosedError = "[server] closed";
@@ -208,14 +315,24 @@ class TransportMessages {
 
   static final clientMemoryError = "[client] out of memory";
   static final clientClosedError = "[client] closed";
+  static clientDeadlineError(int id, Duration deadline) => "[client] call $id exceeded deadline of $deadline";
   static clientError(int result, TransportBindings bindings) => "[client] code = $result, message = ${_kernelErrorToString(result, bindings)}";
   static clientSocketError(int result) => "[client] unable to set socket option: ${-result}";
 
   static final fileMemory = "[file] out of memory";
   static final fileClosedError = "[file] closed";
   static fileOpenError(String path) => "[file] open file failed: $path";
+  static fileMapError(String path) => "[file] map file failed: $path";
   static fileError(int result, TransportBindings bindings) => "[file] code = $result, message = ${_kernelErrorToString(result, bindings)}";
 
+  static final sharedMemoryError = "[shared] out of memory";
+  static final sharedClosedError = "[shared] closed";
+  static sharedError(int result, TransportBindings bindings) => "[shared] code = $result, message = ${_kernelErrorToString(result, bindings)}";
+
+  static frameLengthError(int length, int maxLength) => "[frame] length $length is out of range, limit is $maxLength bytes";
+
+  static tlsError(int result, TransportBindings bindings) => "[tls] code = $result, message = ${_kernelErrorToString(result, bindings)}";
+
   static internalError(TransportEvent event, int code, TransportBindings bindings) => "[$event] code = $code, message = ${_kernelErrorToString(code, bindings)}";
   static canceledError(TransportEvent event) => "[$event] canceled";
   static zeroDataError(TransportEvent event) => "[$event] completed with zero result (no data)";
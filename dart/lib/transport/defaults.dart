@@ -1,13 +1,19 @@
 import 'client/configuration.dart';
 import 'configuration.dart';
+import 'constants.dart';
 import 'server/configuration.dart';
+import 'shared/configuration.dart';
 
 class TransportDefaults {
   TransportDefaults._();
 
   static TransportWorkerConfiguration worker() => TransportWorkerConfiguration(
-        trace: false,
+        trace: true,
+        traceCapacity: 4096,
         buffersCount: 4096,
+        buffersMaxCount: 0,
+        buffersGrowOccupancy: 0.9,
+        buffersShrinkOccupancy: 0.25,
         bufferSize: 4096,
         ringSize: 16384,
         ringFlags: 0,
@@ -24,6 +30,7 @@ class TransportDefaults {
         socketReceiveBufferSize: 4 * 1024 * 1024,
         socketSendBufferSize: 4 * 1024 * 1024,
         pool: 1,
+        selection: TransportClientSelection.roundRobin,
         connectTimeout: Duration(seconds: 60),
         readTimeout: Duration(seconds: 60),
         writeTimeout: Duration(seconds: 60),
@@ -48,6 +55,7 @@ class TransportDefaults {
         socketReceiveBufferSize: 4 * 1024 * 1024,
         socketSendBufferSize: 4 * 1024 * 1024,
         pool: 1,
+        selection: TransportClientSelection.roundRobin,
         connectTimeout: Duration(seconds: 60),
         readTimeout: Duration(seconds: 60),
         writeTimeout: Duration(seconds: 60),
@@ -55,6 +63,15 @@ class TransportDefaults {
         socketCloexec: true,
       );
 
+  static TransportUnixDatagramClientConfiguration unixDatagramClient() => TransportUnixDatagramClientConfiguration(
+        socketReceiveBufferSize: 4 * 1024 * 1024,
+        socketSendBufferSize: 4 * 1024 * 1024,
+        readTimeout: Duration(seconds: 60),
+        writeTimeout: Duration(seconds: 60),
+        socketNonblock: true,
+        socketCloexec: true,
+      );
+
   static TransportTcpServerConfiguration tcpServer() => TransportTcpServerConfiguration(
         socketMaxConnections: 4096,
         socketReceiveBufferSize: 4 * 1024 * 1024,
@@ -83,4 +100,16 @@ class TransportDefaults {
         socketNonblock: true,
         socketCloexec: true,
       );
+
+  static TransportUnixDatagramServerConfiguration unixDatagramServer() => TransportUnixDatagramServerConfiguration(
+        socketReceiveBufferSize: 4 * 1024 * 1024,
+        socketSendBufferSize: 4 * 1024 * 1024,
+        socketNonblock: true,
+        socketCloexec: true,
+      );
+
+  static TransportSharedConfiguration shared() => TransportSharedConfiguration(
+        capacity: 1024 * 1024,
+        connectTimeout: Duration(seconds: 60),
+      );
 }
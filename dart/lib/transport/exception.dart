@@ -49,6 +49,32 @@ class TransportClosedException implements Exception {
 
   factory TransportClosedException.forFile({TransportPayload? payload}) => TransportClosedException._(TransportMessages.fileClosedError);
 
+  factory TransportClosedException.forShared({TransportPayload? payload}) => TransportClosedException._(TransportMessages.sharedClosedError);
+
+  @override
+  String toString() => message;
+}
+
+class TransportDeadlineException implements Exception {
+  final int id;
+  final Duration deadline;
+
+  late final String message;
+
+  TransportDeadlineException(this.id, this.deadline) : this.message = TransportMessages.clientDeadlineError(id, deadline);
+
+  @override
+  String toString() => message;
+}
+
+class TransportFrameLengthException implements Exception {
+  final int length;
+  final int maxLength;
+
+  late final String message;
+
+  TransportFrameLengthException(this.length, this.maxLength) : message = TransportMessages.frameLengthError(length, maxLength);
+
   @override
   String toString() => message;
 }
@@ -0,0 +1,106 @@
+import 'dart:async';
+import 'dart:collection';
+import 'dart:math';
+import 'dart:typed_data';
+
+import '../constants.dart';
+import '../exception.dart';
+import 'file.dart';
+
+class TransportFileAppender {
+  final TransportFileChannel _file;
+  final bool _dataOnly;
+  final int _maxBatchSize;
+  final int _preallocationSize;
+  final _appends = Queue<Uint8List>();
+  final _completers = Queue<Completer<void>>();
+
+  int _position;
+  int _allocated;
+  var _flushing = false;
+  Exception? _failure;
+
+  int get position => _position;
+  int get queued => _appends.length;
+  bool get flushing => _flushing;
+  Exception? get failure => _failure;
+
+  TransportFileAppender(
+    this._file,
+    this._position, {
+    bool dataOnly = true,
+    int maxBatchSize = 64,
+    int preallocationSize = 0,
+  })  : _dataOnly = dataOnly,
+        _maxBatchSize = maxBatchSize,
+        _preallocationSize = preallocationSize,
+        _allocated = _position;
+
+  Future<void> append(Uint8List bytes) {
+    if (!_file.active) return Future.error(TransportClosedException.forFile());
+    if (_failure != null) return Future.error(_failure!);
+    final completer = Completer<void>();
+    _appends.add(bytes);
+    _completers.add(completer);
+    if (!_flushing) _flush();
+    return completer.future;
+  }
+
+  @pragma(preferInlinePragma)
+  Future<void> appendMany(List<Uint8List> bytes) => Future.wait(bytes.map(append));
+
+  void _flush() {
+    if (_appends.isEmpty) {
+      _flushing = false;
+      return;
+    }
+    _flushing = true;
+    final bufferSize = _file.buffers.bufferSize;
+    final chunks = <Uint8List>[];
+    final completers = <Completer<void>>[];
+    var length = 0;
+    while (_appends.isNotEmpty && (chunks.isEmpty || chunks.length + (_appends.first.length / bufferSize).ceil() <= _maxBatchSize)) {
+      final bytes = _appends.removeFirst();
+      completers.add(_completers.removeFirst());
+      for (var offset = 0; offset < bytes.length; offset += bufferSize) {
+        chunks.add(Uint8List.sublistView(bytes, offset, min(offset + bufferSize, bytes.length)));
+      }
+      length += bytes.length;
+    }
+    final offset = _position;
+    final end = offset + length;
+    var allocateOffset = 0;
+    var allocateLength = 0;
+    if (_preallocationSize > 0 && end > _allocated) {
+      allocateOffset = _allocated;
+      allocateLength = max(_preallocationSize, end - _allocated);
+      _allocated += allocateLength;
+    }
+    var failed = false;
+    void onError(Exception error) {
+      if (failed) return;
+      failed = true;
+      _failure = error;
+      _flushing = false;
+      for (var completer in completers) completer.completeError(error);
+      while (_completers.isNotEmpty) _completers.removeFirst().completeError(error);
+      _appends.clear();
+    }
+
+    unawaited(_file
+        .commit(
+          chunks,
+          offset: offset,
+          dataOnly: _dataOnly,
+          allocateOffset: allocateOffset,
+          allocateLength: allocateLength,
+          onError: onError,
+          onDone: () {
+            _position = end;
+            for (var completer in completers) completer.complete();
+            _flush();
+          },
+        )
+        .onError((error, stackTrace) => onError(error as Exception)));
+  }
+}
@@ -10,6 +10,7 @@ import '../constants.dart';
 import '../exception.dart';
 import '../payload.dart';
 import 'file.dart';
+import 'mapped.dart';
 import 'provider.dart';
 import 'registry.dart';
 import 'package:meta/meta.dart';
@@ -52,6 +53,32 @@ class TransportFilesFactory {
     return TransportFile(file, delegate);
   }
 
+  TransportMappedFile map(String path, {TransportFileAdvice? advice}) {
+    final delegate = File(path);
+    final size = delegate.lengthSync();
+    final fd = using((Arena arena) => _bindings.transport_file_open(path.toNativeUtf8(allocator: arena).cast(), TransportFileMode.readOnly.mode, false, false));
+    if (fd < 0) throw TransportInitializationException(TransportMessages.fileOpenError(path));
+    final address = _bindings.transport_file_map(fd, size);
+    if (address == nullptr) {
+      _bindings.transport_close_descriptor(fd);
+      throw TransportInitializationException(TransportMessages.fileMapError(path));
+    }
+    final file = TransportFileChannel(
+      path,
+      fd,
+      _bindings,
+      _workerPointer,
+      TransportChannel(_workerPointer, fd, _bindings, _buffers),
+      _buffers,
+      _payloadPool,
+      _registry,
+    );
+    _registry.add(fd, file);
+    final mapped = TransportMappedFile(file, _bindings, address, size, delegate);
+    if (advice != null) mapped.advise(advice);
+    return mapped;
+  }
+
   @visibleForTesting
   TransportFileRegistry get registry => _registry;
 }
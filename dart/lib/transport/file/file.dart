@@ -4,6 +4,7 @@ import 'dart:typed_data';
 
 import '../bindings.dart';
 import '../buffers.dart';
+import '../callbacks.dart';
 import '../channel.dart';
 import '../constants.dart';
 import '../exception.dart';
@@ -13,8 +14,6 @@ import 'package:meta/meta.dart';
 
 class TransportFileChannel {
   final _inboundEvents = StreamController<TransportPayload>();
-  final _outboundErrorHandlers = <int, void Function(Exception error)>{};
-  final _outboundDoneHandlers = <int, void Function()>{};
 
   final String path;
   final int _fd;
@@ -22,6 +21,7 @@ class TransportFileChannel {
   final TransportBindings _bindings;
   final TransportChannel _channel;
   final TransportBuffers buffers;
+  final TransportCallbacks _callbacks;
   final TransportPayloadPool _payloadPool;
   final TransportFileRegistry _registry;
 
@@ -42,25 +42,80 @@ class TransportFileChannel {
     this.buffers,
     this._payloadPool,
     this._registry,
-  );
+  ) : _callbacks = buffers.callbacks;
 
-  Future<void> readSingle({int offset = 0}) async {
+  @pragma(preferInlinePragma)
+  bool tryReadSingle({int offset = 0}) {
+    if (_closing) return false;
+    final bufferId = buffers.get();
+    if (bufferId == null) return false;
+    _readSingle(bufferId, offset);
+    return true;
+  }
+
+  @pragma(preferInlinePragma)
+  Future<void> readSingle({int offset = 0}) => tryReadSingle(offset: offset) ? transportCompleted : _readSingleAsync(offset);
+
+  Future<void> _readSingleAsync(int offset) async {
     final bufferId = buffers.get() ?? await buffers.allocate();
     if (_closing) return Future.error(TransportClosedException.forFile());
+    _readSingle(bufferId, offset);
+  }
+
+  @pragma(preferInlinePragma)
+  void _readSingle(int bufferId, int offset) {
+    _callbacks.setInbound(bufferId, null, null);
+    _channel.read(bufferId, transportEventRead | transportEventFile, offset: offset);
+    _pending++;
+  }
+
+  Future<void> readBlock(
+    int offset, {
+    required void Function(TransportPayload payload) onRead,
+    required void Function(Exception error) onError,
+  }) async {
+    final bufferId = buffers.get() ?? await buffers.allocate();
+    if (_closing) {
+      buffers.release(bufferId);
+      return Future.error(TransportClosedException.forFile());
+    }
+    _callbacks.setInbound(bufferId, onRead, onError);
     _channel.read(bufferId, transportEventRead | transportEventFile, offset: offset);
     _pending++;
   }
 
+  @pragma(preferInlinePragma)
+  bool tryWriteSingle(
+    Uint8List bytes, {
+    int offset = 0,
+    void Function(Exception error)? onError,
+    void Function()? onDone,
+  }) {
+    if (_closing) return false;
+    final bufferId = buffers.get();
+    if (bufferId == null) return false;
+    _writeSingle(bufferId, bytes, offset, onError, onDone);
+    return true;
+  }
+
+  @pragma(preferInlinePragma)
   Future<void> writeSingle(
     Uint8List bytes, {
     int offset = 0,
     void Function(Exception error)? onError,
     void Function()? onDone,
-  }) async {
+  }) =>
+      tryWriteSingle(bytes, offset: offset, onError: onError, onDone: onDone) ? transportCompleted : _writeSingleAsync(bytes, offset, onError, onDone);
+
+  Future<void> _writeSingleAsync(Uint8List bytes, int offset, void Function(Exception error)? onError, void Function()? onDone) async {
     final bufferId = buffers.get() ?? await buffers.allocate();
     if (_closing) return Future.error(TransportClosedException.forFile());
-    if (onError != null) _outboundErrorHandlers[bufferId] = onError;
-    if (onDone != null) _outboundDoneHandlers[bufferId] = onDone;
+    _writeSingle(bufferId, bytes, offset, onError, onDone);
+  }
+
+  @pragma(preferInlinePragma)
+  void _writeSingle(int bufferId, Uint8List bytes, int offset, void Function(Exception error)? onError, void Function()? onDone) {
+    _callbacks.setOutbound(bufferId, onError, onDone);
     _channel.write(bytes, bufferId, transportEventWrite | transportEventFile, offset: offset);
     _pending++;
   }
@@ -71,6 +126,7 @@ class TransportFileChannel {
     final lastBufferId = bufferIds.last;
     for (var index = 0; index < count - 1; index++) {
       final bufferId = bufferIds[index];
+      _callbacks.setInbound(bufferId, null, null);
       _channel.read(
         bufferId,
         transportEventRead | transportEventFile,
@@ -79,6 +135,7 @@ class TransportFileChannel {
       );
       offset += buffers.bufferSize;
     }
+    _callbacks.setInbound(lastBufferId, null, null);
     _channel.read(
       lastBufferId,
       transportEventRead | transportEventFile,
@@ -106,8 +163,7 @@ class TransportFileChannel {
         offset: offset,
       );
       offset += buffers.bufferSize;
-      if (onError != null) _outboundErrorHandlers[bufferId] = onError;
-      if (onDone != null) _outboundDoneHandlers[bufferId] = onDone;
+      _callbacks.setOutbound(bufferId, onError, onDone);
     }
     _channel.write(
       bytes.last,
@@ -115,40 +171,182 @@ class TransportFileChannel {
       transportEventWrite | transportEventFile,
       offset: offset,
     );
-    if (onError != null) _outboundErrorHandlers[lastBufferId] = onError;
-    if (onDone != null) _outboundDoneHandlers[lastBufferId] = onDone;
+    _callbacks.setOutbound(lastBufferId, onError, onDone);
     _pending += bytes.length;
   }
 
+  Future<void> commit(
+    List<Uint8List> bytes, {
+    int offset = 0,
+    bool dataOnly = true,
+    int allocateOffset = 0,
+    int allocateLength = 0,
+    void Function(Exception error)? onError,
+    void Function()? onDone,
+  }) async {
+    final bufferIds = await buffers.allocateArray(bytes.length + (allocateLength > 0 ? 2 : 1));
+    if (_closing) {
+      buffers.releaseArray(bufferIds);
+      return Future.error(TransportClosedException.forFile());
+    }
+    final commit = _TransportFileCommit(bytes, offset, dataOnly, onError, onDone);
+    if (allocateLength > 0) {
+      final bufferId = bufferIds.removeLast();
+      _callbacks.setResult(bufferId, (result) => _notifyCommit(commit, transportEventAllocate, result));
+      _channel.allocate(
+        bufferId,
+        transportEventAllocate | transportEventFile,
+        mode: transportFileAllocateKeepSize,
+        offset: allocateOffset,
+        length: allocateLength,
+        sqeFlags: transportIosqeIoLink,
+      );
+      commit.inflight++;
+      _pending++;
+    }
+    _submitCommit(commit, bufferIds);
+  }
+
+  void _submitCommit(_TransportFileCommit commit, List<int> bufferIds) {
+    var offset = commit.offset;
+    commit.written = List.filled(commit.chunks.length, 0);
+    for (var index = 0; index < commit.chunks.length; index++) {
+      final bufferId = bufferIds[index];
+      final chunk = index;
+      _channel.write(
+        commit.chunks[index],
+        bufferId,
+        transportEventWrite | transportEventFile,
+        sqeFlags: transportIosqeIoLink,
+        offset: offset,
+      );
+      _callbacks.setResult(bufferId, (result) => _notifyCommit(commit, transportEventWrite, result, chunk: chunk));
+      offset += commit.chunks[index].length;
+    }
+    final syncBufferId = bufferIds[commit.chunks.length];
+    _callbacks.setResult(syncBufferId, (result) => _notifyCommit(commit, transportEventSync, result));
+    _channel.sync(syncBufferId, transportEventSync | transportEventFile, dataOnly: commit.dataOnly);
+    commit.inflight += commit.chunks.length + 1;
+    _pending += commit.chunks.length + 1;
+  }
+
+  void _notifyCommit(_TransportFileCommit commit, int event, int result, {int chunk = -1}) {
+    if (chunk >= 0 && result >= 0) {
+      commit.written[chunk] = result;
+      if (result < commit.chunks[chunk].length) commit.short = true;
+    }
+    if (result < 0 && commit.failure == null && !(result == -ECANCELED && commit.short)) {
+      commit.failure = createTransportException(TransportEvent.fileEvent(event), result, _bindings);
+    }
+    if (--commit.inflight > 0) return;
+    if (commit.failure != null) {
+      commit.onError?.call(commit.failure!);
+      return;
+    }
+    if (!commit.short) {
+      commit.onDone?.call();
+      return;
+    }
+    final remaining = commit.remaining();
+    if (remaining == null) {
+      commit.onError?.call(createTransportException(TransportEvent.fileEvent(transportEventWrite), -EIO, _bindings));
+      return;
+    }
+    if (_closing) {
+      commit.onError?.call(TransportClosedException.forFile());
+      return;
+    }
+    unawaited(buffers.allocateArray(remaining.length + 1).then((bufferIds) {
+      if (_closing) {
+        buffers.releaseArray(bufferIds);
+        commit.onError?.call(TransportClosedException.forFile());
+        return;
+      }
+      _submitCommit(commit, bufferIds);
+    }));
+  }
+
+  Future<void> advise(
+    Pointer<Void> address,
+    int length,
+    int advice, {
+    void Function(Exception error)? onError,
+    void Function()? onDone,
+  }) async {
+    if (_closing) return Future.error(TransportClosedException.forFile());
+    final bufferId = buffers.get() ?? await buffers.allocate();
+    if (_closing) {
+      buffers.release(bufferId);
+      return Future.error(TransportClosedException.forFile());
+    }
+    _callbacks.setResult(bufferId, (result) {
+      if (result >= 0) {
+        onDone?.call();
+        return;
+      }
+      onError?.call(createTransportException(TransportEvent.fileEvent(transportEventAdvise), result, _bindings));
+    });
+    _channel.advise(bufferId, address, length, advice, transportEventAdvise | transportEventFile);
+    _pending++;
+  }
+
+  @pragma(preferInlinePragma)
+  void _completeClosing() {
+    if (_pending == 0 && _closing && !_closer.isCompleted) {
+      _active = false;
+      _closer.complete();
+    }
+  }
+
   void notify(int bufferId, int result, int event) {
     _pending--;
+    final onResult = _callbacks.takeResult(bufferId);
+    if (onResult != null) {
+      buffers.release(bufferId);
+      onResult(result);
+      _completeClosing();
+      return;
+    }
     if (_active) {
       if (_pending == 0 && _closing) {
         _active = false;
         _closer.complete();
       }
       if (event == transportEventRead) {
+        final onRead = _callbacks.takeRead(bufferId);
+        final onReadError = _callbacks.takeError(bufferId);
         if (result >= 0) {
           buffers.setLength(bufferId, result);
-          _inboundEvents.add(_payloadPool.getPayload(bufferId, buffers.read(bufferId)));
+          final payload = _payloadPool.getPayload(bufferId, buffers.read(bufferId));
+          if (onRead != null) {
+            onRead(payload);
+            return;
+          }
+          _inboundEvents.add(payload);
           return;
         }
         buffers.release(bufferId);
-        _inboundEvents.addError(createTransportException(TransportEvent.fileEvent(event), result, _bindings));
+        final error = createTransportException(TransportEvent.fileEvent(event), result, _bindings);
+        if (onReadError != null) {
+          onReadError(error);
+          return;
+        }
+        _inboundEvents.addError(error);
         return;
       }
       if (event == transportEventWrite) {
         buffers.release(bufferId);
         if (result >= 0) {
-          _outboundDoneHandlers.remove(bufferId)?.call();
+          _callbacks.notifyDone(bufferId);
           return;
         }
-        _outboundErrorHandlers.remove(bufferId)?.call(createTransportException(TransportEvent.fileEvent(event), result, _bindings));
+        _callbacks.notifyError(bufferId, createTransportException(TransportEvent.fileEvent(event), result, _bindings));
         return;
       }
       buffers.release(bufferId);
       return;
     }
+    _callbacks.clear(bufferId);
     buffers.release(bufferId);
     if (_pending == 0 && _closing && !_closer.isCompleted) _closer.complete();
   }
@@ -180,10 +378,47 @@ class TransportFileChannel {
     }
     _active = false;
     if (_inboundEvents.hasListener) await _inboundEvents.close();
-    _channel.close();
     _registry.remove(_fd);
+    _channel.close();
   }
 
   @visibleForTesting
   TransportFileRegistry get registry => _registry;
 }
+
+class _TransportFileCommit {
+  final bool dataOnly;
+  final void Function(Exception error)? onError;
+  final void Function()? onDone;
+
+  List<Uint8List> chunks;
+  int offset;
+  List<int> written = const [];
+  Exception? failure;
+  var inflight = 0;
+  var short = false;
+
+  _TransportFileCommit(this.chunks, this.offset, this.dataOnly, this.onError, this.onDone);
+
+  List<Uint8List>? remaining() {
+    var completed = 0;
+    var index = 0;
+    while (index < chunks.length && written[index] == chunks[index].length) completed += written[index++];
+    if (index < chunks.length) completed += written[index];
+    if (completed == 0) return null;
+    final remaining = <Uint8List>[];
+    var skip = completed;
+    for (var chunk in chunks) {
+      if (skip >= chunk.length) {
+        skip -= chunk.length;
+        continue;
+      }
+      remaining.add(Uint8List.sublistView(chunk, skip));
+      skip = 0;
+    }
+    offset += completed;
+    chunks = remaining;
+    short = false;
+    return remaining;
+  }
+}
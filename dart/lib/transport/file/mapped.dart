@@ -0,0 +1,59 @@
+import 'dart:async';
+import 'dart:ffi';
+import 'dart:io';
+import 'dart:typed_data';
+
+import '../bindings.dart';
+import '../constants.dart';
+import '../exception.dart';
+import 'file.dart';
+
+class TransportMappedFile {
+  final TransportFileChannel _file;
+  final TransportBindings _bindings;
+  final Pointer<Void> _address;
+  final File delegate;
+  final int size;
+
+  late final Uint8List bytes;
+  late final int _pageSize;
+  var _mapped = true;
+
+  bool get active => _mapped && _file.active;
+
+  TransportMappedFile(this._file, this._bindings, this._address, this.size, this.delegate) {
+    bytes = _address.cast<Uint8>().asTypedList(size);
+    _pageSize = _bindings.getpagesize();
+  }
+
+  @pragma(preferInlinePragma)
+  Uint8List view({int offset = 0, int? length}) => Uint8List.sublistView(bytes, offset, length == null ? null : offset + length);
+
+  void advise(TransportFileAdvice advice, {int offset = 0, int? length}) {
+    final start = offset - offset % _pageSize;
+    final result = _bindings.transport_file_advise(Pointer.fromAddress(_address.address + start), (length ?? size - offset) + offset - start, advice.advice);
+    if (result < 0) throw TransportInternalException(event: TransportEvent.fileAdvise, code: result, bindings: _bindings);
+  }
+
+  Future<void> prefetch({int offset = 0, int? length}) {
+    final start = offset - offset % _pageSize;
+    final completer = Completer<void>();
+    unawaited(_file
+        .advise(
+          Pointer.fromAddress(_address.address + start),
+          (length ?? size - offset) + offset - start,
+          TransportFileAdvice.willNeed.advice,
+          onError: completer.completeError,
+          onDone: completer.complete,
+        )
+        .onError((error, stackTrace) => completer.completeError(error!)));
+    return completer.future;
+  }
+
+  Future<void> close({Duration? gracefulTimeout}) async {
+    if (!_mapped) return;
+    await _file.close(gracefulTimeout: gracefulTimeout);
+    _mapped = false;
+    _bindings.transport_file_unmap(_address, size);
+  }
+}
@@ -6,6 +6,7 @@ import 'dart:typed_data';
 import '../constants.dart';
 import '../exception.dart';
 import '../payload.dart';
+import 'appender.dart';
 import 'file.dart';
 
 class TransportFile {
@@ -28,6 +29,7 @@ class TransportFile {
 
   @pragma(preferInlinePragma)
   void writeSingle(Uint8List bytes, {void Function(Exception error)? onError, void Function()? onDone}) {
+    if (_file.tryWriteSingle(bytes, onError: onError, onDone: onDone)) return;
     unawaited(_file.writeSingle(bytes, onError: onError, onDone: onDone).onError((error, stackTrace) => onError?.call(error as Exception)));
   }
 
@@ -43,7 +45,19 @@ class TransportFile {
   }
 
   @pragma(preferInlinePragma)
-  Future<Uint8List> load({int blocksCount = 1, int offset = 0}) => delegate.stat().then((stat) => _loadFile(blocksCount, offset, stat));
+  Future<Uint8List> load({int blocksCount = 1, int offset = 0, bool parallel = false}) =>
+      delegate.stat().then((stat) => parallel ? _loadFileParallel(blocksCount, offset, stat) : _loadFile(blocksCount, offset, stat));
+
+  @pragma(preferInlinePragma)
+  Future<TransportFileAppender> appender({bool dataOnly = true, int maxBatchSize = 64, int preallocationSize = 0}) => delegate.length().then(
+        (length) => TransportFileAppender(
+          _file,
+          length,
+          dataOnly: dataOnly,
+          maxBatchSize: maxBatchSize,
+          preallocationSize: preallocationSize,
+        ),
+      );
 
   @pragma(preferInlinePragma)
   Future<void> close({Duration? gracefulTimeout}) => _file.close(gracefulTimeout: gracefulTimeout);
@@ -122,4 +136,58 @@ class TransportFile {
     }));
     return completer.future.whenComplete(subscription.cancel);
   }
+
+  Future<Uint8List> _loadFileParallel(int depth, int offset, FileStat stat) {
+    final size = max(stat.size - offset, 0);
+    final bytes = Uint8List(size);
+    final completer = Completer<Uint8List>();
+    final bufferSize = _file.buffers.bufferSize;
+    var end = size;
+    var next = 0;
+    var inflight = 0;
+
+    void fail(Object error) {
+      if (!completer.isCompleted) completer.completeError(error);
+    }
+
+    late void Function(int position, int length) readBlock;
+
+    void fill() {
+      while (!completer.isCompleted && inflight < depth && next < end) {
+        final length = min(bufferSize, end - next);
+        readBlock(next, length);
+        next += length;
+      }
+      if (!completer.isCompleted && inflight == 0 && next >= end) {
+        completer.complete(end == size ? bytes : Uint8List.sublistView(bytes, 0, end));
+      }
+    }
+
+    readBlock = (position, length) {
+      inflight++;
+      unawaited(_file
+          .readBlock(
+            offset + position,
+            onRead: (payload) {
+              inflight--;
+              final received = min(payload.bytes.length, length);
+              if (received == 0) end = min(end, position);
+              if (received > 0 && position < end) {
+                bytes.setRange(position, position + min(received, end - position), payload.bytes);
+                if (received < length) readBlock(position + received, length - received);
+              }
+              payload.release();
+              fill();
+            },
+            onError: (error) {
+              inflight--;
+              fail(error);
+            },
+          )
+          .onError((error, stackTrace) => fail(error!)));
+    };
+
+    fill();
+    return completer.future;
+  }
 }
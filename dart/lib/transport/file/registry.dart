@@ -1,21 +1,29 @@
 import 'package:meta/meta.dart';
 
 import '../constants.dart';
+import '../handles.dart';
 import 'file.dart';
 
 class TransportFileRegistry {
   final _files = <int, TransportFileChannel>{};
+  final TransportHandles _handles;
 
-  TransportFileRegistry();
+  TransportFileRegistry(this._handles);
 
   @pragma(preferInlinePragma)
-  TransportFileChannel? get(int fd) => _files[fd];
+  TransportFileChannel? get(int handle) => _handles.get<TransportFileChannel>(handle);
 
   @pragma(preferInlinePragma)
-  void remove(int fd) => _files.remove(fd);
+  void remove(int fd) {
+    final file = _files.remove(fd);
+    if (file != null) _handles.remove(fd, file);
+  }
 
   @pragma(preferInlinePragma)
-  void add(int fd, TransportFileChannel file) => _files[fd] = file;
+  void add(int fd, TransportFileChannel file) {
+    _handles.add(fd, file);
+    _files[fd] = file;
+  }
 
   @pragma(preferInlinePragma)
   Future<void> close({Duration? gracefulTimeout}) => Future.wait(_files.values.toList().map((file) => file.close(gracefulTimeout: gracefulTimeout)));
@@ -0,0 +1,85 @@
+import 'dart:math';
+import 'dart:typed_data';
+
+import 'constants.dart';
+import 'exception.dart';
+
+const transportFrameLengthSize = 4;
+const transportFrameIdSize = 8;
+const transportFrameHeaderSize = transportFrameLengthSize + transportFrameIdSize;
+
+@pragma(preferInlinePragma)
+Uint8List encodeTransportFrame(int id, Uint8List body) {
+  final frame = Uint8List(transportFrameHeaderSize + body.length);
+  ByteData.sublistView(frame)
+    ..setUint32(0, transportFrameIdSize + body.length)
+    ..setUint64(transportFrameLengthSize, id);
+  frame.setAll(transportFrameHeaderSize, body);
+  return frame;
+}
+
+class TransportFrameDecoder {
+  final void Function(int id, Uint8List body) _onFrame;
+  final void Function(Exception error) _onError;
+  final int _maxFrameLength;
+
+  var _buffer = Uint8List(0);
+  var _start = 0;
+  var _end = 0;
+  var _failed = false;
+
+  bool get failed => _failed;
+
+  TransportFrameDecoder(this._onFrame, this._onError, {required int maxFrameLength}) : _maxFrameLength = maxFrameLength;
+
+  void add(Uint8List bytes) {
+    if (_failed) return;
+    if (_start == _end) {
+      final offset = _decode(bytes, 0, bytes.length);
+      if (offset >= 0 && offset < bytes.length) _append(bytes, offset);
+      return;
+    }
+    _append(bytes, 0);
+    final offset = _decode(_buffer, _start, _end);
+    if (offset < 0) return;
+    _start = offset;
+    if (_start == _end) _start = _end = 0;
+  }
+
+  int _decode(Uint8List bytes, int offset, int end) {
+    final data = ByteData.sublistView(bytes);
+    while (end - offset >= transportFrameLengthSize) {
+      final length = data.getUint32(offset);
+      if (length < transportFrameIdSize || transportFrameLengthSize + length > _maxFrameLength) {
+        _failed = true;
+        _buffer = Uint8List(0);
+        _start = _end = 0;
+        _onError(TransportFrameLengthException(transportFrameLengthSize + length, _maxFrameLength));
+        return -1;
+      }
+      final frameEnd = offset + transportFrameLengthSize + length;
+      if (frameEnd > end) break;
+      _onFrame(data.getUint64(offset + transportFrameLengthSize), bytes.sublist(offset + transportFrameHeaderSize, frameEnd));
+      offset = frameEnd;
+    }
+    return offset;
+  }
+
+  void _append(Uint8List bytes, int from) {
+    final length = bytes.length - from;
+    if (_end + length > _buffer.length) {
+      final pending = _end - _start;
+      if (pending + length > _buffer.length) {
+        final buffer = Uint8List(max(_buffer.length * 2, pending + length));
+        buffer.setRange(0, pending, _buffer, _start);
+        _buffer = buffer;
+      } else {
+        _buffer.setRange(0, pending, _buffer, _start);
+      }
+      _start = 0;
+      _end = pending;
+    }
+    _buffer.setRange(_end, _end + length, bytes, from);
+    _end += length;
+  }
+}
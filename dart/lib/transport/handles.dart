@@ -0,0 +1,56 @@
+import 'dart:ffi';
+import 'dart:typed_data';
+
+import 'bindings.dart';
+import 'constants.dart';
+import 'exception.dart';
+
+class TransportHandles {
+  final _values = <Object?>[];
+  final _bound = <int, int>{};
+  final _free = <int>[];
+  final TransportBindings _bindings;
+  final Pointer<transport_worker_t> _workerPointer;
+
+  var _generations = Uint8List(1);
+
+  TransportHandles(this._bindings, this._workerPointer);
+
+  @pragma(preferInlinePragma)
+  T? get<T extends Object>(int handle) {
+    final index = handle & transportHandleIndexMask;
+    if (index >= _values.length || _generations[index] != handle >> transportHandleIndexBits) return null;
+    final value = _values[index];
+    return value is T ? value : null;
+  }
+
+  int add(int fd, Object value) {
+    final index = _free.isNotEmpty ? _free.removeLast() : _allocate();
+    final generation = _generations[index] = _generations[index] % transportHandleGenerationMask + 1;
+    final handle = (generation << transportHandleIndexBits) | index;
+    if (_bindings.transport_worker_bind(_workerPointer, fd, handle) < 0) {
+      _free.add(index);
+      throw TransportInitializationException(TransportMessages.workerMemoryError);
+    }
+    _values[index] = value;
+    _bound[fd] = handle;
+    return handle;
+  }
+
+  void remove(int fd, Object value) {
+    final handle = _bound[fd];
+    if (handle == null || !identical(get<Object>(handle), value)) return;
+    _bound.remove(fd);
+    _bindings.transport_worker_unbind(_workerPointer, fd, handle);
+    _values[handle & transportHandleIndexMask] = null;
+    _free.add(handle & transportHandleIndexMask);
+  }
+
+  int _allocate() {
+    final index = _values.length;
+    if (index > transportHandleIndexMask) throw TransportInitializationException(TransportMessages.workerMemoryError);
+    _values.add(null);
+    if (index == _generations.length) _generations = Uint8List(index * 2)..setAll(0, _generations);
+    return index;
+  }
+}
@@ -0,0 +1,67 @@
+import 'dart:ffi';
+import 'dart:typed_data';
+
+import 'bindings.dart';
+import 'constants.dart';
+
+class TransportLatencyHistogram {
+  final int count;
+  final int sum;
+  final int min;
+  final int max;
+  final Uint64List _buckets;
+
+  TransportLatencyHistogram._(this.count, this.sum, this.min, this.max, this._buckets);
+
+  factory TransportLatencyHistogram.fromNative(transport_histogram_t histogram) {
+    final buckets = Uint64List(TRANSPORT_HISTOGRAM_BUCKETS);
+    for (var index = 0; index < TRANSPORT_HISTOGRAM_BUCKETS; index++) {
+      buckets[index] = histogram.buckets[index];
+    }
+    return TransportLatencyHistogram._(histogram.count, histogram.sum, histogram.count == 0 ? 0 : histogram.min, histogram.max, buckets);
+  }
+
+  Duration get mean => count == 0 ? Duration.zero : _duration(sum ~/ count);
+  Duration get p50 => percentile(0.5);
+  Duration get p99 => percentile(0.99);
+  Duration get p999 => percentile(0.999);
+
+  @pragma(preferInlinePragma)
+  Duration percentile(double quantile) => _duration(percentileNanos(quantile));
+
+  int percentileNanos(double quantile) {
+    if (count == 0) return 0;
+    final rank = (quantile.clamp(0.0, 1.0) * count).ceil().clamp(1, count);
+    var cumulative = 0;
+    for (var index = 0; index < TRANSPORT_HISTOGRAM_BUCKETS; index++) {
+      cumulative += _buckets[index];
+      if (cumulative >= rank) return _upperBound(index).clamp(this.min, this.max);
+    }
+    return this.max;
+  }
+
+  @pragma(preferInlinePragma)
+  static Duration _duration(int nanos) => Duration(microseconds: nanos ~/ 1000);
+
+  @pragma(preferInlinePragma)
+  static int _upperBound(int index) {
+    if (index < TRANSPORT_HISTOGRAM_SUB_BUCKETS) return index;
+    final shift = index ~/ TRANSPORT_HISTOGRAM_SUB_BUCKETS - 1;
+    final mantissa = index % TRANSPORT_HISTOGRAM_SUB_BUCKETS;
+    final upper = ((TRANSPORT_HISTOGRAM_SUB_BUCKETS + mantissa + 1) << shift) - 1;
+    return upper < 0 ? maxNanos : upper;
+  }
+
+  static const maxNanos = 0x7fffffffffffffff;
+}
+
+class TransportLatencies {
+  final Map<TransportOperation, TransportLatencyHistogram> _histograms;
+
+  TransportLatencies.fromNative(Pointer<transport_histogram_t> histograms)
+      : _histograms = {for (final operation in TransportOperation.values) operation: TransportLatencyHistogram.fromNative(histograms.elementAt(operation.operation).ref)};
+
+  TransportLatencyHistogram operator [](TransportOperation operation) => _histograms[operation]!;
+
+  Iterable<MapEntry<TransportOperation, TransportLatencyHistogram>> get entries => _histograms.entries;
+}
@@ -0,0 +1,116 @@
+import 'dart:async';
+import 'dart:collection';
+import 'dart:ffi';
+
+import 'bindings.dart';
+import 'constants.dart';
+import 'exception.dart';
+import 'server/provider.dart';
+import 'server/server.dart';
+
+class TransportWorkerMessage {
+  final int worker;
+  final int data;
+  final int value;
+
+  const TransportWorkerMessage(this.worker, this.data, this.value);
+}
+
+class TransportWorkerTarget {
+  final int id;
+  final int _address;
+
+  const TransportWorkerTarget._(this.id, this._address);
+}
+
+class TransportMessenger {
+  late final _messages = StreamController<TransportWorkerMessage>(onListen: _drain, onResume: _drain);
+  final _queue = Queue<Object>();
+  final TransportBindings _bindings;
+  final Pointer<transport_worker_t> _workerPointer;
+
+  TransportServerChannel? _adopter;
+  var _dropped = 0;
+
+  TransportWorkerTarget get target => TransportWorkerTarget._(_workerPointer.ref.id, _workerPointer.address);
+  Stream<TransportWorkerMessage> get messages => _messages.stream;
+  int get queued => _queue.length;
+  int get dropped => _dropped;
+
+  TransportMessenger(this._bindings, this._workerPointer);
+
+  @pragma(preferInlinePragma)
+  void post(TransportWorkerTarget target, int data, {int value = 0}) => _bindings.transport_worker_send_ring_message(
+        _workerPointer,
+        Pointer.fromAddress(target._address),
+        data,
+        value,
+        0,
+      );
+
+  Future<void> handOff(TransportWorkerTarget target, TransportServerConnection connection) async {
+    final fd = await connection.detach();
+    _bindings.transport_worker_send_ring_message(
+      _workerPointer,
+      Pointer.fromAddress(target._address),
+      fd,
+      0,
+      transportEventAccept,
+    );
+  }
+
+  @pragma(preferInlinePragma)
+  void adopt(TransportServer server) => _adopter = server as TransportServerChannel;
+
+  void notify(int data, int worker, int result, int event) {
+    if (event & transportEventWrite != 0) {
+      final handOff = event & transportEventAccept != 0;
+      if (handOff) _bindings.transport_close_descriptor(data);
+      _deliver(
+        TransportInternalException(
+          event: handOff ? TransportEvent.handOff : TransportEvent.message,
+          code: result,
+          bindings: _bindings,
+        ),
+      );
+      return;
+    }
+    if (event & transportEventAccept != 0) {
+      final adopter = _adopter;
+      if (adopter == null || !adopter.active) {
+        _bindings.transport_close_descriptor(data);
+        return;
+      }
+      adopter.adopt(data);
+      return;
+    }
+    _deliver(TransportWorkerMessage(worker, data, result));
+  }
+
+  void _deliver(Object message) {
+    if (_queue.isEmpty && _messages.hasListener && !_messages.isPaused) {
+      _emit(message);
+      return;
+    }
+    if (_queue.length >= transportMessagesQueueCapacity) {
+      _dropped++;
+      return;
+    }
+    _queue.add(message);
+  }
+
+  void _drain() {
+    while (_queue.isNotEmpty && _messages.hasListener && !_messages.isPaused) {
+      _emit(_queue.removeFirst());
+    }
+  }
+
+  @pragma(preferInlinePragma)
+  void _emit(Object message) => message is TransportWorkerMessage ? _messages.add(message) : _messages.addError(message);
+
+  Future<void> close() async {
+    _adopter = null;
+    _queue.clear();
+    if (_messages.hasListener) await _messages.close();
+  }
+}
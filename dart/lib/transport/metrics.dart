@@ -0,0 +1,46 @@
+import 'dart:ffi';
+
+import 'bindings.dart';
+import 'constants.dart';
+
+class TransportWorkerMetrics {
+  final Pointer<transport_worker_metrics_t> _metrics;
+
+  TransportWorkerMetrics(this._metrics);
+
+  TransportWorkerMetrics.fromAddress(int address) : _metrics = Pointer.fromAddress(address);
+
+  int get address => _metrics.address;
+
+  int get sqesPrepared => _metrics.ref.sqes_prepared;
+  int get submits => _metrics.ref.submits;
+  int get cqesReaped => _metrics.ref.cqes_reaped;
+  int get emptyPeeks => _metrics.ref.empty_peeks;
+  int get sqFullWaits => _metrics.ref.sq_full_waits;
+  int get timeouts => _metrics.ref.timeouts;
+  int get cancellations => _metrics.ref.cancellations;
+  int get bytesRead => _metrics.ref.bytes_read;
+  int get bytesWritten => _metrics.ref.bytes_written;
+  int get bytesReceived => _metrics.ref.bytes_received;
+  int get bytesSent => _metrics.ref.bytes_sent;
+  int get unroutedCompletions => _metrics.ref.unrouted_completions;
+
+  @pragma(preferInlinePragma)
+  void recordUnrouted() => _metrics.ref.unrouted_completions++;
+
+  @pragma(preferInlinePragma)
+  Map<String, int> snapshot() => {
+        "sqesPrepared": sqesPrepared,
+        "submits": submits,
+        "cqesReaped": cqesReaped,
+        "emptyPeeks": emptyPeeks,
+        "sqFullWaits": sqFullWaits,
+        "timeouts": timeouts,
+        "cancellations": cancellations,
+        "bytesRead": bytesRead,
+        "bytesWritten": bytesWritten,
+        "bytesReceived": bytesReceived,
+        "bytesSent": bytesSent,
+        "unroutedCompletions": unroutedCompletions,
+      };
+}
@@ -1,3 +1,4 @@
+import 'dart:math';
 import 'dart:typed_data';
 
 import 'buffers.dart';
@@ -8,15 +9,32 @@ class TransportPayloadPool {
   final _payloads = <TransportPayload>[];
 
   TransportPayloadPool(int buffersCount, this._buffers) {
-    for (var bufferId = 0; bufferId < buffersCount; bufferId++) {
+    _grow(buffersCount);
+    _buffers.onGrowth(_grow);
+  }
+
+  void _grow(int buffersCount) {
+    for (var bufferId = _payloads.length; bufferId < buffersCount; bufferId++) {
       _payloads.add(TransportPayload(bufferId, this));
     }
   }
 
   @pragma(preferInlinePragma)
-  TransportPayload getPayload(int bufferId, Uint8List bytes) {
+  TransportPayload getPayload(int bufferId, Uint8List bytes, {int segmentSize = 0}) {
     final payload = _payloads[bufferId];
     payload._bytes = bytes;
+    payload._segmentSize = segmentSize;
+    payload._kernelTimestamp = 0;
+    payload._reapTimestamp = 0;
+    payload._deliveryTimestamp = 0;
+    return payload;
+  }
+
+  @pragma(preferInlinePragma)
+  TransportPayload stampPayload(TransportPayload payload, int kernelTimestamp, int reapTimestamp) {
+    payload._kernelTimestamp = kernelTimestamp;
+    payload._reapTimestamp = reapTimestamp;
+    payload._deliveryTimestamp = DateTime.now().microsecondsSinceEpoch * 1000;
     return payload;
   }
 
@@ -26,10 +44,19 @@ class TransportPayloadPool {
 
 class TransportPayload {
   late Uint8List _bytes;
+  var _segmentSize = 0;
+  var _kernelTimestamp = 0;
+  var _reapTimestamp = 0;
+  var _deliveryTimestamp = 0;
   final int _bufferId;
   final TransportPayloadPool _pool;
 
   Uint8List get bytes => _bytes;
+  int get segmentSize => _segmentSize;
+  List<Uint8List> get segments => splitSegments(_bytes, _segmentSize);
+  int get kernelTimestamp => _kernelTimestamp;
+  int get reapTimestamp => _reapTimestamp;
+  int get deliveryTimestamp => _deliveryTimestamp;
 
   TransportPayload(this._bufferId, this._pool);
 
@@ -50,3 +77,12 @@ class TransportPayload {
     return result;
   }
 }
+
+List<Uint8List> splitSegments(Uint8List bytes, int segmentSize) {
+  if (segmentSize == 0 || segmentSize >= bytes.length) return [bytes];
+  final segments = <Uint8List>[];
+  for (var offset = 0; offset < bytes.length; offset += segmentSize) {
+    segments.add(Uint8List.sublistView(bytes, offset, min(offset + segmentSize, bytes.length)));
+  }
+  return segments;
+}
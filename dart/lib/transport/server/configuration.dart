@@ -3,6 +3,10 @@ import '../configuration.dart';
 class TransportTcpServerConfiguration {
   final Duration? readTimeout;
   final Duration? writeTimeout;
+  final int? outboundHighWatermark;
+  final int? outboundLowWatermark;
+  final double? admissionHighOccupancy;
+  final double? admissionLowOccupancy;
   final int? socketMaxConnections;
   final int? socketReceiveBufferSize;
   final int? socketSendBufferSize;
@@ -28,6 +32,10 @@ class TransportTcpServerConfiguration {
   TransportTcpServerConfiguration({
     this.readTimeout,
     this.writeTimeout,
+    this.outboundHighWatermark,
+    this.outboundLowWatermark,
+    this.admissionHighOccupancy,
+    this.admissionLowOccupancy,
     this.socketMaxConnections,
     this.socketReceiveBufferSize,
     this.socketSendBufferSize,
@@ -54,6 +62,10 @@ class TransportTcpServerConfiguration {
   TransportTcpServerConfiguration copyWith({
     Duration? readTimeout,
     Duration? writeTimeout,
+    int? outboundHighWatermark,
+    int? outboundLowWatermark,
+    double? admissionHighOccupancy,
+    double? admissionLowOccupancy,
     int? socketMaxConnections,
     int? socketReceiveBufferSize,
     int? socketSendBufferSize,
@@ -79,6 +91,10 @@ class TransportTcpServerConfiguration {
       TransportTcpServerConfiguration(
         readTimeout: readTimeout ?? this.readTimeout,
         writeTimeout: writeTimeout ?? this.writeTimeout,
+        outboundHighWatermark: outboundHighWatermark ?? this.outboundHighWatermark,
+        outboundLowWatermark: outboundLowWatermark ?? this.outboundLowWatermark,
+        admissionHighOccupancy: admissionHighOccupancy ?? this.admissionHighOccupancy,
+        admissionLowOccupancy: admissionLowOccupancy ?? this.admissionLowOccupancy,
         socketMaxConnections: socketMaxConnections ?? this.socketMaxConnections,
         socketReceiveBufferSize: socketReceiveBufferSize ?? this.socketReceiveBufferSize,
         socketSendBufferSize: socketSendBufferSize ?? this.socketSendBufferSize,
@@ -121,6 +137,8 @@ class TransportUdpServerConfiguration {
   final TransportUdpMulticastConfiguration? ipMulticastInterface;
   final int? ipMulticastLoop;
   final int? ipMulticastTtl;
+  final bool? udpGro;
+  final bool? socketTimestamping;
   final TransportUdpMulticastManager? multicastManager;
 
   TransportUdpServerConfiguration({
@@ -141,6 +159,8 @@ class TransportUdpServerConfiguration {
     this.ipMulticastInterface,
     this.ipMulticastLoop,
     this.ipMulticastTtl,
+    this.udpGro,
+    this.socketTimestamping,
     this.multicastManager,
   });
 
@@ -162,6 +182,8 @@ class TransportUdpServerConfiguration {
     TransportUdpMulticastConfiguration? ipMulticastInterface,
     int? ipMulticastLoop,
     int? ipMulticastTtl,
+    bool? udpGro,
+    bool? socketTimestamping,
     TransportUdpMulticastManager? multicastManager,
   }) =>
       TransportUdpServerConfiguration(
@@ -182,6 +204,8 @@ class TransportUdpServerConfiguration {
         ipMulticastInterface: ipMulticastInterface ?? this.ipMulticastInterface,
         ipMulticastLoop: ipMulticastLoop ?? this.ipMulticastLoop,
         ipMulticastTtl: ipMulticastTtl ?? this.ipMulticastTtl,
+        udpGro: udpGro ?? this.udpGro,
+        socketTimestamping: socketTimestamping ?? this.socketTimestamping,
         multicastManager: multicastManager ?? this.multicastManager,
       );
 }
@@ -189,6 +213,10 @@ class TransportUdpServerConfiguration {
 class TransportUnixStreamServerConfiguration {
   final Duration? readTimeout;
   final Duration? writeTimeout;
+  final int? outboundHighWatermark;
+  final int? outboundLowWatermark;
+  final double? admissionHighOccupancy;
+  final double? admissionLowOccupancy;
   final int? socketMaxConnections;
   final int? socketReceiveBufferSize;
   final int? socketSendBufferSize;
@@ -201,6 +229,10 @@ class TransportUnixStreamServerConfiguration {
   TransportUnixStreamServerConfiguration({
     this.readTimeout,
     this.writeTimeout,
+    this.outboundHighWatermark,
+    this.outboundLowWatermark,
+    this.admissionHighOccupancy,
+    this.admissionLowOccupancy,
     this.socketMaxConnections,
     this.socketReceiveBufferSize,
     this.socketSendBufferSize,
@@ -214,6 +246,10 @@ class TransportUnixStreamServerConfiguration {
   TransportUnixStreamServerConfiguration copyWith({
     Duration? readTimeout,
     Duration? writeTimeout,
+    int? outboundHighWatermark,
+    int? outboundLowWatermark,
+    double? admissionHighOccupancy,
+    double? admissionLowOccupancy,
     int? socketMaxConnections,
     int? socketReceiveBufferSize,
     int? socketSendBufferSize,
@@ -226,6 +262,10 @@ class TransportUnixStreamServerConfiguration {
       TransportUnixStreamServerConfiguration(
         readTimeout: readTimeout ?? this.readTimeout,
         writeTimeout: writeTimeout ?? this.writeTimeout,
+        outboundHighWatermark: outboundHighWatermark ?? this.outboundHighWatermark,
+        outboundLowWatermark: outboundLowWatermark ?? this.outboundLowWatermark,
+        admissionHighOccupancy: admissionHighOccupancy ?? this.admissionHighOccupancy,
+        admissionLowOccupancy: admissionLowOccupancy ?? this.admissionLowOccupancy,
         socketMaxConnections: socketMaxConnections ?? this.socketMaxConnections,
         socketReceiveBufferSize: socketReceiveBufferSize ?? this.socketReceiveBufferSize,
         socketSendBufferSize: socketSendBufferSize ?? this.socketSendBufferSize,
@@ -236,3 +276,46 @@ class TransportUnixStreamServerConfiguration {
         socketSendLowAt: socketSendLowAt ?? this.socketSendLowAt,
       );
 }
+
+class TransportUnixDatagramServerConfiguration {
+  final Duration? readTimeout;
+  final Duration? writeTimeout;
+  final int? socketReceiveBufferSize;
+  final int? socketSendBufferSize;
+  final bool? socketNonblock;
+  final bool? socketCloexec;
+  final int? socketReceiveLowAt;
+  final int? socketSendLowAt;
+
+  TransportUnixDatagramServerConfiguration({
+    this.readTimeout,
+    this.writeTimeout,
+    this.socketReceiveBufferSize,
+    this.socketSendBufferSize,
+    this.socketNonblock,
+    this.socketCloexec,
+    this.socketReceiveLowAt,
+    this.socketSendLowAt,
+  });
+
+  TransportUnixDatagramServerConfiguration copyWith({
+    Duration? readTimeout,
+    Duration? writeTimeout,
+    int? socketReceiveBufferSize,
+    int? socketSendBufferSize,
+    bool? socketNonblock,
+    bool? socketCloexec,
+    int? socketReceiveLowAt,
+    int? socketSendLowAt,
+  }) =>
+      TransportUnixDatagramServerConfiguration(
+        readTimeout: readTimeout ?? this.readTimeout,
+        writeTimeout: writeTimeout ?? this.writeTimeout,
+        socketReceiveBufferSize: socketReceiveBufferSize ?? this.socketReceiveBufferSize,
+        socketSendBufferSize: socketSendBufferSize ?? this.socketSendBufferSize,
+        socketNonblock: socketNonblock ?? this.socketNonblock,
+        socketCloexec: socketCloexec ?? this.socketCloexec,
+        socketReceiveLowAt: socketReceiveLowAt ?? this.socketReceiveLowAt,
+        socketSendLowAt: socketSendLowAt ?? this.socketSendLowAt,
+      );
+}
@@ -73,6 +73,10 @@ class TransportServersFactory {
           _registry,
           _payloadPool,
           _datagramResponderPool,
+          outboundHighWatermark: configuration.outboundHighWatermark,
+          outboundLowWatermark: configuration.outboundLowWatermark,
+          admissionHighOccupancy: configuration.admissionHighOccupancy,
+          admissionLowOccupancy: configuration.admissionLowOccupancy,
         );
       },
     );
@@ -159,6 +163,7 @@ class TransportServersFactory {
             _bindings,
             _buffers,
           ),
+          timestamps: configuration.socketTimestamping == true,
         );
       },
     );
@@ -166,21 +171,36 @@ class TransportServersFactory {
     return TransportServerDatagramReceiver(server);
   }
 
+  @pragma(preferInlinePragma)
   TransportServer unixStream(
     String path,
     void Function(TransportServerConnection connection) onAccept, {
     TransportUnixStreamServerConfiguration? configuration,
+  }) =>
+      _unixConnections(path, onAccept, configuration ?? TransportDefaults.unixStreamServer(), _bindings.transport_server_initialize_unix_stream);
+
+  @pragma(preferInlinePragma)
+  TransportServer unixSeqpacket(
+    String path,
+    void Function(TransportServerConnection connection) onAccept, {
+    TransportUnixStreamServerConfiguration? configuration,
+  }) =>
+      _unixConnections(path, onAccept, configuration ?? TransportDefaults.unixStreamServer(), _bindings.transport_server_initialize_unix_seqpacket);
+
+  TransportServerDatagramReceiver unixDatagram(
+    String path, {
+    TransportUnixDatagramServerConfiguration? configuration,
   }) {
-    configuration = configuration ?? TransportDefaults.unixStreamServer();
+    configuration = configuration ?? TransportDefaults.unixDatagramServer();
     final server = using(
       (Arena arena) {
         final pointer = calloc<transport_server_t>();
         if (pointer == nullptr) {
           throw TransportInitializationException(TransportMessages.serverMemoryError);
         }
-        final result = _bindings.transport_server_initialize_unix_stream(
+        final result = _bindings.transport_server_initialize_unix_datagram(
           pointer,
-          _unixStreamConfiguration(configuration!, arena),
+          _unixDatagramConfiguration(configuration!, arena),
           path.toNativeUtf8(allocator: arena).cast(),
         );
         if (result < 0) {
@@ -202,6 +222,59 @@ class TransportServersFactory {
           _registry,
           _payloadPool,
           _datagramResponderPool,
+          datagramChannel: TransportChannel(
+            _workerPointer,
+            pointer.ref.fd,
+            _bindings,
+            _buffers,
+          ),
+        );
+      },
+    );
+    _registry.addServer(server.pointer.ref.fd, server);
+    return TransportServerDatagramReceiver(server);
+  }
+
+  TransportServer _unixConnections(
+    String path,
+    void Function(TransportServerConnection connection) onAccept,
+    TransportUnixStreamServerConfiguration configuration,
+    int Function(Pointer<transport_server_t> server, Pointer<transport_server_configuration_t> configuration, Pointer<Char> path) initialize,
+  ) {
+    final server = using(
+      (Arena arena) {
+        final pointer = calloc<transport_server_t>();
+        if (pointer == nullptr) {
+          throw TransportInitializationException(TransportMessages.serverMemoryError);
+        }
+        final result = initialize(
+          pointer,
+          _unixStreamConfiguration(configuration, arena),
+          path.toNativeUtf8(allocator: arena).cast(),
+        );
+        if (result < 0) {
+          if (pointer.ref.fd > 0) {
+            _bindings.transport_close_descriptor(pointer.ref.fd);
+            calloc.free(pointer);
+            throw TransportInitializationException(TransportMessages.serverError(result, _bindings));
+          }
+          calloc.free(pointer);
+          throw TransportInitializationException(TransportMessages.serverSocketError(result));
+        }
+        return TransportServerChannel(
+          pointer,
+          _workerPointer,
+          _bindings,
+          configuration.readTimeout?.inSeconds,
+          configuration.writeTimeout?.inSeconds,
+          _buffers,
+          _registry,
+          _payloadPool,
+          _datagramResponderPool,
+          outboundHighWatermark: configuration.outboundHighWatermark,
+          outboundLowWatermark: configuration.outboundLowWatermark,
+          admissionHighOccupancy: configuration.admissionHighOccupancy,
+          admissionLowOccupancy: configuration.admissionLowOccupancy,
         );
       },
     );
@@ -280,6 +353,8 @@ class TransportServersFactory {
     if (serverConfiguration.ipFreebind == true) flags |= transportSocketOptionIpFreebind;
     if (serverConfiguration.ipMulticastAll == true) flags |= transportSocketOptionIpMulticastAll;
     if (serverConfiguration.ipMulticastLoop == true) flags |= transportSocketOptionIpMulticastLoop;
+    if (serverConfiguration.udpGro == true) flags |= transportSocketOptionUdpGro;
+    if (serverConfiguration.socketTimestamping == true) flags |= transportSocketOptionSocketTimestamping;
     if (serverConfiguration.socketReceiveBufferSize != null) {
       flags |= transportSocketOptionSocketRcvbuf;
       nativeServerConfiguration.ref.socket_receive_buffer_size = serverConfiguration.socketReceiveBufferSize!;
@@ -348,6 +423,31 @@ class TransportServersFactory {
     return nativeServerConfiguration;
   }
 
+  Pointer<transport_server_configuration_t> _unixDatagramConfiguration(TransportUnixDatagramServerConfiguration serverConfiguration, Allocator allocator) {
+    final nativeServerConfiguration = allocator<transport_server_configuration_t>();
+    var flags = 0;
+    if (serverConfiguration.socketNonblock == true) flags |= transportSocketOptionSocketNonblock;
+    if (serverConfiguration.socketCloexec == true) flags |= transportSocketOptionSocketCloexec;
+    if (serverConfiguration.socketReceiveBufferSize != null) {
+      flags |= transportSocketOptionSocketRcvbuf;
+      nativeServerConfiguration.ref.socket_receive_buffer_size = serverConfiguration.socketReceiveBufferSize!;
+    }
+    if (serverConfiguration.socketSendBufferSize != null) {
+      flags |= transportSocketOptionSocketSndbuf;
+      nativeServerConfiguration.ref.socket_send_buffer_size = serverConfiguration.socketSendBufferSize!;
+    }
+    if (serverConfiguration.socketReceiveLowAt != null) {
+      flags |= transportSocketOptionSocketRcvlowat;
+      nativeServerConfiguration.ref.socket_receive_low_at = serverConfiguration.socketReceiveLowAt!;
+    }
+    if (serverConfiguration.socketSendLowAt != null) {
+      flags |= transportSocketOptionSocketSndlowat;
+      nativeServerConfiguration.ref.socket_send_low_at = serverConfiguration.socketSendLowAt!;
+    }
+    nativeServerConfiguration.ref.socket_configuration_flags = flags;
+    return nativeServerConfiguration;
+  }
+
   int _getMembershipIndex(TransportUdpMulticastConfiguration configuration) => using(
         (arena) {
           if (configuration.calculateInterfaceIndex) {
@@ -1,7 +1,10 @@
 import 'dart:async';
 import 'dart:typed_data';
 
+import '../configuration.dart';
 import '../constants.dart';
+import '../exception.dart';
+import '../frame.dart';
 import '../payload.dart';
 import 'responder.dart';
 import 'server.dart';
@@ -13,6 +16,9 @@ class TransportServerConnection {
 
   Stream<TransportPayload> get inbound => _connection.inbound;
   bool get active => _connection.active;
+  bool get writable => _connection.writable;
+  int get outbound => _connection.outbound;
+  int get bufferSize => _connection.bufferSize;
 
   @pragma(preferInlinePragma)
   Future<void> read() => _connection.read();
@@ -20,11 +26,16 @@ class TransportServerConnection {
   @pragma(preferInlinePragma)
   Stream<TransportPayload> stream() {
     final out = StreamController<TransportPayload>(sync: true);
-    out.onListen = () => unawaited(_connection.read().onError((error, stackTrace) => out.addError(error!)));
+    void read() {
+      if (_connection.tryRead()) return;
+      unawaited(_connection.read().onError((error, stackTrace) => out.addError(error!)));
+    }
+
+    out.onListen = read;
     _connection.inbound.listen(
       (event) {
         out.add(event);
-        if (_connection.active) unawaited(_connection.read().onError((error, stackTrace) => out.addError(error!)));
+        if (_connection.active) read();
       },
       onDone: out.close,
       onError: out.addError,
@@ -32,8 +43,12 @@ class TransportServerConnection {
     return out.stream;
   }
 
+  @pragma(preferInlinePragma)
+  Future<void> whenWritable() => _connection.whenWritable();
+
   @pragma(preferInlinePragma)
   void writeSingle(Uint8List bytes, {void Function(Exception error)? onError, void Function()? onDone}) {
+    if (_connection.tryWriteSingle(bytes, onError: onError, onDone: onDone)) return;
     unawaited(_connection.writeSingle(bytes, onError: onError, onDone: onDone).onError((error, stackTrace) => onError?.call(error as Exception)));
   }
 
@@ -48,9 +63,48 @@ class TransportServerConnection {
     }).onError((error, stackTrace) => onError?.call(error as Exception)));
   }
 
+  void serveMultiplexed(FutureOr<Uint8List> Function(Uint8List request) handler, {void Function(Exception error)? onError}) {
+    void respond(int id, Uint8List response) {
+      if (transportFrameHeaderSize + response.length > bufferSize) {
+        onError?.call(TransportFrameLengthException(transportFrameHeaderSize + response.length, bufferSize));
+        return;
+      }
+      writeSingle(encodeTransportFrame(id, response), onError: onError);
+    }
+
+    final decoder = TransportFrameDecoder(
+      (id, request) {
+        final response = handler(request);
+        if (response is Future<Uint8List>) {
+          unawaited(response.then((response) => respond(id, response), onError: (error) => onError?.call(error as Exception)));
+          return;
+        }
+        respond(id, response);
+      },
+      (error) {
+        onError?.call(error);
+        unawaited(close());
+      },
+      maxFrameLength: bufferSize,
+    );
+    stream().listen(
+      (payload) {
+        decoder.add(payload.bytes);
+        payload.release();
+      },
+      onError: (error) => onError?.call(error as Exception),
+    );
+  }
+
+  @pragma(preferInlinePragma)
+  void enableTls({required TransportTlsKeys transmit, TransportTlsKeys? receive}) => _connection.enableTls(transmit, receive);
+
   @pragma(preferInlinePragma)
   Future<void> close({Duration? gracefulTimeout}) => _connection.close(gracefulTimeout: gracefulTimeout);
 
+  @pragma(preferInlinePragma)
+  Future<int> detach() => _connection.detach();
+
   @pragma(preferInlinePragma)
   Future<void> closeServer({Duration? gracefulTimeout}) => _connection.closeServer(gracefulTimeout: gracefulTimeout);
 }
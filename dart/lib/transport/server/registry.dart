@@ -1,31 +1,45 @@
 import 'package:meta/meta.dart';
 
 import '../constants.dart';
+import '../handles.dart';
 import 'server.dart';
 
 class TransportServerRegistry {
   final _servers = <int, TransportServerChannel>{};
   final _serverConnections = <int, TransportServerConnectionChannel>{};
+  final TransportHandles _handles;
 
-  TransportServerRegistry();
+  TransportServerRegistry(this._handles);
 
   @pragma(preferInlinePragma)
-  TransportServerChannel? getServer(int fd) => _servers[fd];
+  TransportServerChannel? getServer(int handle) => _handles.get<TransportServerChannel>(handle);
 
   @pragma(preferInlinePragma)
-  TransportServerConnectionChannel? getConnection(int fd) => _serverConnections[fd];
+  TransportServerConnectionChannel? getConnection(int handle) => _handles.get<TransportServerConnectionChannel>(handle);
 
   @pragma(preferInlinePragma)
-  void addConnection(int connectionFd, TransportServerConnectionChannel connection) => _serverConnections[connectionFd] = connection;
+  void addConnection(int connectionFd, TransportServerConnectionChannel connection) {
+    _handles.add(connectionFd, connection);
+    _serverConnections[connectionFd] = connection;
+  }
 
   @pragma(preferInlinePragma)
-  void removeConnection(int fd) => _serverConnections.remove(fd);
+  void removeConnection(int fd) {
+    final connection = _serverConnections.remove(fd);
+    if (connection != null) _handles.remove(fd, connection);
+  }
 
   @pragma(preferInlinePragma)
-  void removeServer(int fd) => _servers.remove(fd);
+  void removeServer(int fd) {
+    final server = _servers.remove(fd);
+    if (server != null) _handles.remove(fd, server);
+  }
 
   @pragma(preferInlinePragma)
-  void addServer(int fd, TransportServerChannel channel) => _servers[fd] = channel;
+  void addServer(int fd, TransportServerChannel channel) {
+    _handles.add(fd, channel);
+    _servers[fd] = channel;
+  }
 
   @pragma(preferInlinePragma)
   Future<void> close({Duration? gracefulTimeout}) => Future.wait(_servers.values.toList().map((server) => server.close(gracefulTimeout: gracefulTimeout)));
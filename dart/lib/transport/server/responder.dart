@@ -6,6 +6,7 @@ import '../bindings.dart';
 import '../buffers.dart';
 import '../channel.dart';
 import '../constants.dart';
+import '../payload.dart';
 import 'server.dart';
 
 class TransportServerDatagramResponderPool {
@@ -13,7 +14,12 @@ class TransportServerDatagramResponderPool {
   final _datagramResponders = <TransportServerDatagramResponder>[];
 
   TransportServerDatagramResponderPool(int buffersCount, this._buffers) {
-    for (var bufferId = 0; bufferId < buffersCount; bufferId++) {
+    _grow(buffersCount);
+    _buffers.onGrowth(_grow);
+  }
+
+  void _grow(int buffersCount) {
+    for (var bufferId = _datagramResponders.length; bufferId < buffersCount; bufferId++) {
       _datagramResponders.add(TransportServerDatagramResponder(bufferId, this));
     }
   }
@@ -28,14 +34,27 @@ class TransportServerDatagramResponderPool {
     TransportServerChannel server,
     TransportChannel channel,
     Pointer<sockaddr> destination,
+    int segmentSize,
   ) {
     final payload = _datagramResponders[bufferId];
     payload._bytes = bytes;
+    payload._segmentSize = segmentSize;
     payload._server = server;
     payload._channel = channel;
     payload._destination = destination;
+    payload._kernelTimestamp = 0;
+    payload._reapTimestamp = 0;
+    payload._deliveryTimestamp = 0;
     return payload;
   }
+
+  @pragma(preferInlinePragma)
+  TransportServerDatagramResponder stampDatagramResponder(TransportServerDatagramResponder responder, int kernelTimestamp, int reapTimestamp) {
+    responder._kernelTimestamp = kernelTimestamp;
+    responder._reapTimestamp = reapTimestamp;
+    responder._deliveryTimestamp = DateTime.now().microsecondsSinceEpoch * 1000;
+    return responder;
+  }
 }
 
 class TransportServerDatagramResponder {
@@ -46,8 +65,17 @@ class TransportServerDatagramResponder {
   late Uint8List _bytes;
   late TransportServerChannel _server;
   late TransportChannel _channel;
+  var _segmentSize = 0;
+  var _kernelTimestamp = 0;
+  var _reapTimestamp = 0;
+  var _deliveryTimestamp = 0;
 
   Uint8List get receivedBytes => _bytes;
+  int get receivedSegmentSize => _segmentSize;
+  List<Uint8List> get receivedSegments => splitSegments(_bytes, _segmentSize);
+  int get receivedKernelTimestamp => _kernelTimestamp;
+  int get receivedReapTimestamp => _reapTimestamp;
+  int get receivedDeliveryTimestamp => _deliveryTimestamp;
   bool get active => _server.active;
 
   TransportServerDatagramResponder(this._bufferId, this._pool);
@@ -69,10 +97,10 @@ class TransportServerDatagramResponder {
   }
 
   @pragma(preferInlinePragma)
-  void respondMany(List<Uint8List> bytes, {int? flags, bool linked = true, void Function(Exception error)? onError, void Function()? onDone}) {
+  void respondMany(List<Uint8List> bytes, {int? flags, bool linked = true, bool segmented = false, void Function(Exception error)? onError, void Function()? onDone}) {
     var doneCounter = 0;
     var errorCounter = 0;
-    unawaited(_server.respondMany(_channel, _destination, bytes, flags: flags, linked: linked, onError: (error) {
+    unawaited(_server.respondMany(_channel, _destination, bytes, flags: flags, linked: linked, segmented: segmented, onError: (error) {
       if (++errorCounter + doneCounter == bytes.length) onError?.call(error);
     }, onDone: () {
       if (errorCounter == 0 && ++doneCounter == bytes.length) onDone?.call();
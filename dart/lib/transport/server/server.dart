@@ -1,26 +1,32 @@
 import 'dart:async';
 import 'dart:ffi';
+import 'dart:math';
 import 'dart:typed_data';
 
 import 'provider.dart';
 import 'registry.dart';
 import '../bindings.dart';
 import '../buffers.dart';
+import '../callbacks.dart';
 import '../channel.dart';
+import '../configuration.dart';
 import '../constants.dart';
 import '../exception.dart';
 import '../payload.dart';
+import '../watermarks.dart';
 import 'responder.dart';
 
 abstract class TransportServer {
+  bool get overloaded;
+  int get shedAccepts;
+  int get shedReads;
+
   Future<void> close({Duration? gracefulTimeout});
 }
 
 class TransportServerConnectionChannel {
   final _closer = Completer();
   final _inboundEvents = StreamController<TransportPayload>();
-  final _outboundDoneHandlers = <int, void Function()>{};
-  final _outboundErrorHandlers = <int, void Function(Exception error)>{};
 
   final int? _readTimeout;
   final int? _writeTimeout;
@@ -29,7 +35,9 @@ class TransportServerConnectionChannel {
   final TransportBindings _bindings;
   final TransportServerChannel _server;
   final TransportBuffers _buffers;
+  final TransportCallbacks _callbacks;
   final TransportPayloadPool _payloadPool;
+  final TransportOutboundWatermarks _watermarks;
   final int _fd;
 
   var _active = true;
@@ -37,6 +45,9 @@ class TransportServerConnectionChannel {
   var _pending = 0;
 
   bool get active => !_closing;
+  bool get writable => _watermarks.writable;
+  int get outbound => _watermarks.outbound;
+  int get bufferSize => _buffers.bufferSize;
   Stream<TransportPayload> get inbound => _inboundEvents.stream;
 
   TransportServerConnectionChannel(
@@ -49,27 +60,69 @@ class TransportServerConnectionChannel {
     this._writeTimeout,
     this.channel,
     this._workerPointer,
-  );
+    this._watermarks,
+  ) : _callbacks = _buffers.callbacks;
+
+  @pragma(preferInlinePragma)
+  bool tryRead() {
+    if (_closing || _server._closing || !_server._admit()) return false;
+    final bufferId = _buffers.get();
+    if (bufferId == null) return false;
+    channel.read(bufferId, transportEventRead | transportEventServer, timeout: _readTimeout);
+    _pending++;
+    return true;
+  }
+
+  @pragma(preferInlinePragma)
+  Future<void> read() => tryRead() ? transportCompleted : _read();
 
-  Future<void> read() async {
+  Future<void> _read() async {
+    while (!_server._admit()) {
+      _server._shedReads++;
+      await _server._admission!.future;
+    }
     final bufferId = _buffers.get() ?? await _buffers.allocate();
     if (_closing || _server._closing) return Future.error(TransportClosedException.forServer());
     channel.read(bufferId, transportEventRead | transportEventServer, timeout: _readTimeout);
     _pending++;
   }
 
-  Future<void> writeSingle(Uint8List bytes, {void Function(Exception error)? onError, void Function()? onDone}) async {
+  @pragma(preferInlinePragma)
+  Future<void> whenWritable() => _watermarks.whenWritable();
+
+  @pragma(preferInlinePragma)
+  bool tryWriteSingle(Uint8List bytes, {void Function(Exception error)? onError, void Function()? onDone}) {
+    if (_closing || _server._closing || !_watermarks.writable) return false;
+    final bufferId = _buffers.get();
+    if (bufferId == null) return false;
+    _writeSingle(bufferId, bytes, onError, onDone);
+    return true;
+  }
+
+  @pragma(preferInlinePragma)
+  Future<void> writeSingle(Uint8List bytes, {void Function(Exception error)? onError, void Function()? onDone}) =>
+      tryWriteSingle(bytes, onError: onError, onDone: onDone) ? transportCompleted : _writeSingleAsync(bytes, onError, onDone);
+
+  Future<void> _writeSingleAsync(Uint8List bytes, void Function(Exception error)? onError, void Function()? onDone) async {
+    while (!_watermarks.writable) await _watermarks.whenWritable();
     final bufferId = _buffers.get() ?? await _buffers.allocate();
     if (_closing || _server._closing) return Future.error(TransportClosedException.forServer());
-    if (onError != null) _outboundErrorHandlers[bufferId] = onError;
-    if (onDone != null) _outboundDoneHandlers[bufferId] = onDone;
+    _writeSingle(bufferId, bytes, onError, onDone);
+  }
+
+  @pragma(preferInlinePragma)
+  void _writeSingle(int bufferId, Uint8List bytes, void Function(Exception error)? onError, void Function()? onDone) {
+    _watermarks.acquire(1);
+    _callbacks.setOutbound(bufferId, onError, onDone);
     channel.write(bytes, bufferId, transportEventWrite | transportEventServer, timeout: _writeTimeout);
     _pending++;
   }
 
   Future<void> writeMany(List<Uint8List> bytes, {bool linked = true, void Function(Exception error)? onError, void Function()? onDone}) async {
+    while (!_watermarks.writable) await _watermarks.whenWritable();
     final bufferIds = await _buffers.allocateArray(bytes.length);
     if (_closing || _server._closing) return Future.error(TransportClosedException.forServer());
+    _watermarks.acquire(bytes.length);
     final lastBufferId = bufferIds.last;
     for (var index = 0; index < bytes.length - 1; index++) {
       final bufferId = bufferIds[index];
@@ -80,8 +133,7 @@ class TransportServerConnectionChannel {
         sqeFlags: linked ? transportIosqeIoLink : 0,
         timeout: _writeTimeout,
       );
-      if (onError != null) _outboundErrorHandlers[bufferId] = onError;
-      if (onDone != null) _outboundDoneHandlers[bufferId] = onDone;
+      _callbacks.setOutbound(bufferId, onError, onDone);
     }
     channel.write(
       bytes.last,
@@ -89,8 +141,7 @@ class TransportServerConnectionChannel {
       transportEventWrite | transportEventServer,
       timeout: _writeTimeout,
     );
-    if (onError != null) _outboundErrorHandlers[lastBufferId] = onError;
-    if (onDone != null) _outboundDoneHandlers[lastBufferId] = onDone;
+    _callbacks.setOutbound(lastBufferId, onError, onDone);
     _pending += bytes.length;
   }
 
@@ -116,29 +167,41 @@ class TransportServerConnectionChannel {
       }
       if (event == transportEventWrite) {
         _buffers.release(bufferId);
+        _watermarks.release();
         if (result > 0) {
-          _outboundDoneHandlers.remove(bufferId)?.call();
+          _callbacks.notifyDone(bufferId);
           return;
         }
-        _outboundErrorHandlers.remove(bufferId)?.call(createTransportException(TransportEvent.serverEvent(event), result, _bindings));
+        _callbacks.notifyError(bufferId, createTransportException(TransportEvent.serverEvent(event), result, _bindings));
         unawaited(close());
         return;
       }
       _buffers.release(bufferId);
       return;
     }
+    _callbacks.clear(bufferId);
     _buffers.release(bufferId);
     if (_pending == 0 && _closing && !_closer.isCompleted) _closer.complete();
   }
 
   Future<void> close({Duration? gracefulTimeout}) async {
+    if (await _drain(gracefulTimeout)) _bindings.transport_close_descriptor(_fd);
+  }
+
+  Future<int> detach() async {
+    if (!await _drain(null)) throw TransportClosedException.forServer();
+    return _fd;
+  }
+
+  Future<bool> _drain(Duration? gracefulTimeout) async {
     if (_closing) {
       if (!_closer.isCompleted) {
         if (_pending > 0) await _closer.future;
       }
-      return;
+      return false;
     }
     _closing = true;
+    _watermarks.reset();
     if (_pending > 0) {
       if (gracefulTimeout == null) {
         _active = false;
@@ -159,7 +222,13 @@ class TransportServerConnectionChannel {
     _active = false;
     if (_inboundEvents.hasListener) await _inboundEvents.close();
     _server._removeConnection(_fd);
-    _bindings.transport_close_descriptor(_fd);
+    return true;
+  }
+
+  void enableTls(TransportTlsKeys transmit, TransportTlsKeys? receive) {
+    if (_closing || _server._closing) throw TransportClosedException.forServer();
+    final result = channel.enableTls(transmit, receive);
+    if (result < 0) throw TransportInitializationException(TransportMessages.tlsError(result, _bindings));
   }
 
   Future<void> closeServer({Duration? gracefulTimeout}) => _server.close(gracefulTimeout: gracefulTimeout);
@@ -169,8 +238,6 @@ class TransportServerChannel implements TransportServer {
   final _closer = Completer();
   final _connections = <int, TransportServerConnectionChannel>{};
   final _inboundEvents = StreamController<TransportServerDatagramResponder>();
-  final _outboundErrorHandlers = <int, void Function(Exception error)>{};
-  final _outboundDoneHandlers = <int, void Function()>{};
 
   final TransportChannel? _datagramChannel;
   final Pointer<transport_server_t> pointer;
@@ -179,17 +246,29 @@ class TransportServerChannel implements TransportServer {
   final int? _readTimeout;
   final int? _writeTimeout;
   final TransportBuffers _buffers;
+  final TransportCallbacks _callbacks;
   final TransportServerRegistry _registry;
   final TransportPayloadPool _payloadPool;
   final TransportServerDatagramResponderPool _datagramResponderPool;
+  final bool _timestamps;
+  final int? _outboundHighWatermark;
+  final int? _outboundLowWatermark;
+  final double? _admissionHighOccupancy;
+  final double? _admissionLowOccupancy;
 
   late void Function(TransportServerConnection connection) _acceptor;
 
+  Completer<void>? _admission;
   var _pending = 0;
   var _active = true;
   var _closing = false;
+  var _shedAccepts = 0;
+  var _shedReads = 0;
 
   bool get active => !_closing;
+  bool get overloaded => _admission != null;
+  int get shedAccepts => _shedAccepts;
+  int get shedReads => _shedReads;
   Stream<TransportServerDatagramResponder> get inbound => _inboundEvents.stream;
 
   TransportServerChannel(
@@ -203,7 +282,18 @@ class TransportServerChannel implements TransportServer {
     this._payloadPool,
     this._datagramResponderPool, {
     TransportChannel? datagramChannel,
-  }) : this._datagramChannel = datagramChannel;
+    bool timestamps = false,
+    int? outboundHighWatermark,
+    int? outboundLowWatermark,
+    double? admissionHighOccupancy,
+    double? admissionLowOccupancy,
+  })  : this._datagramChannel = datagramChannel,
+        this._timestamps = timestamps,
+        this._callbacks = _buffers.callbacks,
+        this._outboundHighWatermark = outboundHighWatermark,
+        this._outboundLowWatermark = outboundLowWatermark,
+        this._admissionHighOccupancy = admissionHighOccupancy,
+        this._admissionLowOccupancy = admissionHighOccupancy == null ? null : admissionLowOccupancy ?? admissionHighOccupancy * 0.8;
 
   @pragma(preferInlinePragma)
   void accept(void Function(TransportServerConnection connection) onAccept) {
@@ -237,8 +327,7 @@ class TransportServerChannel implements TransportServer {
     flags = flags ?? TransportDatagramMessageFlag.trunc.flag;
     final bufferId = _buffers.get() ?? await _buffers.allocate();
     if (_closing) return Future.error(TransportClosedException.forServer());
-    if (onError != null) _outboundErrorHandlers[bufferId] = onError;
-    if (onDone != null) _outboundDoneHandlers[bufferId] = onDone;
+    _callbacks.setOutbound(bufferId, onError, onDone);
     channel.sendMessage(
       bytes,
       bufferId,
@@ -257,10 +346,15 @@ class TransportServerChannel implements TransportServer {
     List<Uint8List> bytes, {
     int? flags,
     bool linked = false,
+    bool segmented = false,
     void Function(Exception error)? onError,
     void Function()? onDone,
   }) async {
     flags = flags ?? TransportDatagramMessageFlag.trunc.flag;
+    if (segmented) {
+      final segments = _buffers.segmentsPerBuffer(bytes);
+      if (segments > 1) return _respondSegmented(channel, destination, bytes, segments, flags, linked, onError, onDone);
+    }
     final bufferIds = await _buffers.allocateArray(bytes.length);
     if (_closing) return Future.error(TransportClosedException.forServer());
     final lastBufferId = bufferIds.last;
@@ -276,8 +370,7 @@ class TransportServerChannel implements TransportServer {
         sqeFlags: linked ? transportIosqeIoLink : 0,
         timeout: _writeTimeout,
       );
-      if (onError != null) _outboundErrorHandlers[bufferId] = onError;
-      if (onDone != null) _outboundDoneHandlers[bufferId] = onDone;
+      _callbacks.setOutbound(bufferId, onError, onDone);
     }
     channel.sendMessage(
       bytes.last,
@@ -289,11 +382,56 @@ class TransportServerChannel implements TransportServer {
       sqeFlags: linked ? transportIosqeIoLink : 0,
       timeout: _writeTimeout,
     );
-    if (onError != null) _outboundErrorHandlers[lastBufferId] = onError;
-    if (onDone != null) _outboundDoneHandlers[lastBufferId] = onDone;
+    _callbacks.setOutbound(lastBufferId, onError, onDone);
     _pending += bytes.length;
   }
 
+  Future<void> _respondSegmented(
+    TransportChannel channel,
+    Pointer<sockaddr> destination,
+    List<Uint8List> bytes,
+    int segments,
+    int flags,
+    bool linked,
+    void Function(Exception error)? onError,
+    void Function()? onDone,
+  ) async {
+    final count = (bytes.length / segments).ceil();
+    final bufferIds = await _buffers.allocateArray(count);
+    if (_closing) return Future.error(TransportClosedException.forServer());
+    for (var index = 0; index < count; index++) {
+      final bufferId = bufferIds[index];
+      final start = index * segments;
+      final end = min(start + segments, bytes.length);
+      channel.sendMessageSegmented(
+        bytes,
+        start,
+        end,
+        bufferId,
+        pointer.ref.family,
+        destination,
+        flags,
+        transportEventSendMessage | transportEventServer,
+        sqeFlags: linked && index < count - 1 ? transportIosqeIoLink : 0,
+        timeout: _writeTimeout,
+      );
+      _callbacks.setOutbound(
+        bufferId,
+        onError == null
+            ? null
+            : (error) {
+                for (var segment = start; segment < end; segment++) onError(error);
+              },
+        onDone == null
+            ? null
+            : () {
+                for (var segment = start; segment < end; segment++) onDone();
+              },
+      );
+    }
+    _pending += count;
+  }
+
   void notifyDatagram(int bufferId, int result, int event) {
     _pending--;
     if (_active) {
@@ -304,15 +442,22 @@ class TransportServerChannel implements TransportServer {
       if (event == transportEventReceiveMessage) {
         if (result > 0) {
           _buffers.setLength(bufferId, result);
-          _inboundEvents.add(
-            _datagramResponderPool.getDatagramResponder(
-              bufferId,
-              _buffers.read(bufferId),
-              this,
-              _datagramChannel!,
-              _bindings.transport_worker_get_datagram_address(_workerPointer, pointer.ref.family, bufferId),
-            ),
+          final responder = _datagramResponderPool.getDatagramResponder(
+            bufferId,
+            _buffers.read(bufferId),
+            this,
+            _datagramChannel!,
+            _bindings.transport_worker_get_datagram_address(_workerPointer, pointer.ref.family, bufferId),
+            _bindings.transport_worker_get_datagram_segment_size(_workerPointer, pointer.ref.family, bufferId),
           );
+          if (_timestamps) {
+            _datagramResponderPool.stampDatagramResponder(
+              responder,
+              _bindings.transport_worker_get_datagram_timestamp(_workerPointer, pointer.ref.family, bufferId),
+              _workerPointer.ref.reap_timestamp,
+            );
+          }
+          _inboundEvents.add(responder);
           return;
         }
         _buffers.release(bufferId);
@@ -322,15 +467,16 @@ class TransportServerChannel implements TransportServer {
       if (event == transportEventSendMessage) {
         _buffers.release(bufferId);
         if (result > 0) {
-          _outboundDoneHandlers.remove(bufferId)?.call();
+          _callbacks.notifyDone(bufferId);
           return;
         }
-        _outboundErrorHandlers.remove(bufferId)?.call(createTransportException(TransportEvent.serverEvent(event), result, _bindings));
+        _callbacks.notifyError(bufferId, createTransportException(TransportEvent.serverEvent(event), result, _bindings));
         return;
       }
       _buffers.release(bufferId);
       return;
     }
+    _callbacks.clear(bufferId);
     _buffers.release(bufferId);
     if (_pending == 0 && _closing && !_closer.isCompleted) _closer.complete();
   }
@@ -338,24 +484,53 @@ class TransportServerChannel implements TransportServer {
   @pragma(preferInlinePragma)
   void notifyAccept(int fd) {
     if (_closing) return;
-    if (fd > 0) {
-      final channel = TransportChannel(_workerPointer, fd, _bindings, _buffers);
-      final connection = TransportServerConnectionChannel(
-        this,
-        _buffers,
-        _bindings,
-        fd,
-        _payloadPool,
-        _readTimeout,
-        _writeTimeout,
-        channel,
-        _workerPointer,
-      );
-      _registry.addConnection(fd, connection);
-      _connections[fd] = connection;
-      _acceptor(TransportServerConnection(connection));
+    if (fd > 0) adopt(fd);
+    _rearmAccept();
+  }
+
+  void adopt(int fd) {
+    final channel = TransportChannel(_workerPointer, fd, _bindings, _buffers);
+    final connection = TransportServerConnectionChannel(
+      this,
+      _buffers,
+      _bindings,
+      fd,
+      _payloadPool,
+      _readTimeout,
+      _writeTimeout,
+      channel,
+      _workerPointer,
+      TransportOutboundWatermarks(_outboundHighWatermark, _outboundLowWatermark),
+    );
+    _registry.addConnection(fd, connection);
+    _connections[fd] = connection;
+    _acceptor(TransportServerConnection(connection));
+  }
+
+  void _rearmAccept() {
+    if (_closing) return;
+    if (_admit()) {
+      _bindings.transport_worker_accept(_workerPointer, pointer);
+      return;
     }
-    _bindings.transport_worker_accept(_workerPointer, pointer);
+    _shedAccepts++;
+    unawaited(_admission!.future.then((_) => _rearmAccept()));
+  }
+
+  @pragma(preferInlinePragma)
+  bool _admit() {
+    if (_admissionHighOccupancy == null || _closing) return true;
+    if (_admission != null) return false;
+    final buffersCount = _buffers.buffersCount;
+    if (_buffers.used() < (buffersCount * _admissionHighOccupancy!).ceil()) return true;
+    final admission = _admission = Completer();
+    unawaited(_buffers.whenOccupancyBelow(_admissionLowOccupancy!).then((_) => _resumeAdmission(admission)));
+    return false;
+  }
+
+  void _resumeAdmission(Completer<void> admission) {
+    if (identical(_admission, admission)) _admission = null;
+    if (!admission.isCompleted) admission.complete();
   }
 
   @pragma(preferInlinePragma)
@@ -376,6 +551,7 @@ class TransportServerChannel implements TransportServer {
       return;
     }
     _closing = true;
+    if (_admission != null) _resumeAdmission(_admission!);
     await Future.wait(_connections.values.toList().map((connection) => connection.close(gracefulTimeout: gracefulTimeout)));
     if (_pending > 0) {
       if (gracefulTimeout == null) {
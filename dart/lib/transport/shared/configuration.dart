@@ -0,0 +1,26 @@
+class TransportSharedConfiguration {
+  final int capacity;
+  final Duration? connectTimeout;
+  final Duration? readTimeout;
+  final Duration? writeTimeout;
+
+  TransportSharedConfiguration({
+    required this.capacity,
+    this.connectTimeout,
+    this.readTimeout,
+    this.writeTimeout,
+  });
+
+  TransportSharedConfiguration copyWith({
+    int? capacity,
+    Duration? connectTimeout,
+    Duration? readTimeout,
+    Duration? writeTimeout,
+  }) =>
+      TransportSharedConfiguration(
+        capacity: capacity ?? this.capacity,
+        connectTimeout: connectTimeout ?? this.connectTimeout,
+        readTimeout: readTimeout ?? this.readTimeout,
+        writeTimeout: writeTimeout ?? this.writeTimeout,
+      );
+}
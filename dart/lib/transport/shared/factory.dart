@@ -0,0 +1,102 @@
+import 'dart:async';
+import 'dart:ffi';
+
+import 'package:ffi/ffi.dart';
+import 'package:meta/meta.dart';
+
+import '../bindings.dart';
+import '../buffers.dart';
+import '../constants.dart';
+import '../defaults.dart';
+import '../exception.dart';
+import '../payload.dart';
+import '../server/factory.dart';
+import '../server/provider.dart';
+import '../server/server.dart';
+import 'configuration.dart';
+import 'provider.dart';
+import 'registry.dart';
+import 'shared.dart';
+
+class TransportSharedFactory {
+  final TransportSharedRegistry _registry;
+  final TransportBindings _bindings;
+  final Pointer<transport_worker_t> _workerPointer;
+  final TransportBuffers _buffers;
+  final TransportPayloadPool _payloadPool;
+  final TransportServersFactory _servers;
+
+  const TransportSharedFactory(
+    this._registry,
+    this._bindings,
+    this._workerPointer,
+    this._buffers,
+    this._payloadPool,
+    this._servers,
+  );
+
+  TransportServer serve(
+    String path,
+    void Function(TransportSharedConnection connection) onAccept, {
+    TransportSharedConfiguration? configuration,
+  }) {
+    final sharedConfiguration = configuration ?? TransportDefaults.shared();
+    return _servers.unixStream(path, (connection) => unawaited(_accept(connection, sharedConfiguration, onAccept)));
+  }
+
+  Future<TransportSharedConnection> connect(
+    String path, {
+    TransportSharedConfiguration? configuration,
+  }) async {
+    configuration = configuration ?? TransportDefaults.shared();
+    final fd = using((Arena arena) => _bindings.transport_shared_connect(path.toNativeUtf8(allocator: arena).cast()));
+    if (fd < 0) throw TransportInitializationException(TransportMessages.sharedError(fd, _bindings));
+    final pointer = calloc<transport_shared_t>();
+    if (pointer == nullptr) {
+      _bindings.transport_close_descriptor(fd);
+      throw TransportInitializationException(TransportMessages.sharedMemoryError);
+    }
+    final channel = _channel(fd, pointer, configuration);
+    await channel.receive(configuration.connectTimeout?.inSeconds);
+    return TransportSharedConnection(channel);
+  }
+
+  Future<void> _accept(
+    TransportServerConnection connection,
+    TransportSharedConfiguration configuration,
+    void Function(TransportSharedConnection connection) onAccept,
+  ) async {
+    final fd = await connection.detach();
+    final pointer = calloc<transport_shared_t>();
+    if (pointer == nullptr) {
+      _bindings.transport_close_descriptor(fd);
+      return;
+    }
+    var result = _bindings.transport_shared_create(pointer, fd, configuration.capacity);
+    if (result == 0) result = _bindings.transport_shared_send(pointer);
+    if (result < 0) {
+      _bindings.transport_shared_destroy(pointer);
+      return;
+    }
+    onAccept(TransportSharedConnection(_channel(fd, pointer, configuration)));
+  }
+
+  TransportSharedChannel _channel(int fd, Pointer<transport_shared_t> pointer, TransportSharedConfiguration configuration) {
+    final channel = TransportSharedChannel(
+      fd,
+      pointer,
+      _workerPointer,
+      _bindings,
+      _buffers,
+      _payloadPool,
+      _registry,
+      configuration.readTimeout?.inSeconds,
+      configuration.writeTimeout?.inSeconds,
+    );
+    _registry.add(fd, channel);
+    return channel;
+  }
+
+  @visibleForTesting
+  TransportSharedRegistry get registry => _registry;
+}
@@ -0,0 +1,59 @@
+import 'dart:async';
+import 'dart:typed_data';
+
+import '../constants.dart';
+import '../payload.dart';
+import 'shared.dart';
+
+class TransportSharedConnection {
+  final TransportSharedChannel _channel;
+
+  const TransportSharedConnection(this._channel);
+
+  bool get active => _channel.active;
+  int get outbound => _channel.outbound;
+  int get capacity => _channel.capacity;
+  Stream<TransportPayload> get inbound => _channel.inbound;
+
+  Future<void> read() => _channel.read();
+
+  @pragma(preferInlinePragma)
+  Stream<TransportPayload> stream() {
+    final out = StreamController<TransportPayload>(sync: true);
+    void read() {
+      if (_channel.tryRead()) return;
+      unawaited(_channel.read().onError((error, stackTrace) => out.addError(error!)));
+    }
+
+    out.onListen = read;
+    _channel.inbound.listen(
+      (event) {
+        out.add(event);
+        if (_channel.active) read();
+      },
+      onDone: out.close,
+      onError: out.addError,
+    );
+    return out.stream;
+  }
+
+  @pragma(preferInlinePragma)
+  void writeSingle(Uint8List bytes, {void Function(Exception error)? onError, void Function()? onDone}) {
+    if (_channel.tryWriteSingle(bytes, onError: onError, onDone: onDone)) return;
+    unawaited(_channel.writeSingle(bytes, onError: onError, onDone: onDone).onError((error, stackTrace) => onError?.call(error as Exception)));
+  }
+
+  @pragma(preferInlinePragma)
+  void writeMany(List<Uint8List> bytes, {void Function(Exception error)? onError, void Function()? onDone}) {
+    var doneCounter = 0;
+    var errorCounter = 0;
+    unawaited(_channel.writeMany(bytes, onError: (error) {
+      if (++errorCounter + doneCounter == bytes.length) onError?.call(error);
+    }, onDone: () {
+      if (errorCounter == 0 && ++doneCounter == bytes.length) onDone?.call();
+    }).onError((error, stackTrace) => onError?.call(error as Exception)));
+  }
+
+  @pragma(preferInlinePragma)
+  Future<void> close({Duration? gracefulTimeout}) => _channel.close(gracefulTimeout: gracefulTimeout);
+}
@@ -0,0 +1,33 @@
+import 'package:meta/meta.dart';
+
+import '../constants.dart';
+import '../handles.dart';
+import 'shared.dart';
+
+class TransportSharedRegistry {
+  final _channels = <int, TransportSharedChannel>{};
+  final TransportHandles _handles;
+
+  TransportSharedRegistry(this._handles);
+
+  @pragma(preferInlinePragma)
+  TransportSharedChannel? get(int handle) => _handles.get<TransportSharedChannel>(handle);
+
+  @pragma(preferInlinePragma)
+  void remove(int fd) {
+    final channel = _channels.remove(fd);
+    if (channel != null) _handles.remove(fd, channel);
+  }
+
+  @pragma(preferInlinePragma)
+  void add(int fd, TransportSharedChannel channel) {
+    _handles.add(fd, channel);
+    _channels[fd] = channel;
+  }
+
+  @pragma(preferInlinePragma)
+  Future<void> close({Duration? gracefulTimeout}) => Future.wait(_channels.values.toList().map((channel) => channel.close(gracefulTimeout: gracefulTimeout)));
+
+  @visibleForTesting
+  Map<int, TransportSharedChannel> get channels => _channels;
+}
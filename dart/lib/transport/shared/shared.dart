@@ -0,0 +1,246 @@
+import 'dart:async';
+import 'dart:collection';
+import 'dart:ffi';
+import 'dart:typed_data';
+
+import '../bindings.dart';
+import '../buffers.dart';
+import '../callbacks.dart';
+import '../constants.dart';
+import '../exception.dart';
+import '../payload.dart';
+import 'registry.dart';
+
+class TransportSharedChannel {
+  final _closer = Completer();
+  final _connector = Completer<void>();
+  final _inboundEvents = StreamController<TransportPayload>();
+  final _readers = Queue<int>();
+  final _writers = Queue<int>();
+
+  final int _fd;
+  final Pointer<transport_shared_t> _pointer;
+  final Pointer<transport_worker_t> _workerPointer;
+  final TransportBindings _bindings;
+  final TransportBuffers _buffers;
+  final TransportCallbacks _callbacks;
+  final TransportPayloadPool _payloadPool;
+  final TransportSharedRegistry _registry;
+  final int? _readTimeout;
+  final int? _writeTimeout;
+
+  Completer<void>? _flusher;
+  var _active = true;
+  var _closing = false;
+  var _pending = 0;
+
+  bool get active => !_closing;
+  int get outbound => _writers.length;
+  int get capacity => _pointer.ref.capacity;
+  Stream<TransportPayload> get inbound => _inboundEvents.stream;
+
+  TransportSharedChannel(
+    this._fd,
+    this._pointer,
+    this._workerPointer,
+    this._bindings,
+    this._buffers,
+    this._payloadPool,
+    this._registry,
+    this._readTimeout,
+    this._writeTimeout,
+  ) : _callbacks = _buffers.callbacks;
+
+  Future<void> receive(int? timeout) async {
+    final bufferId = _buffers.get() ?? await _buffers.allocate();
+    if (_closing) {
+      _buffers.release(bufferId);
+      return Future.error(TransportClosedException.forShared());
+    }
+    _bindings.transport_shared_receive(_pointer, _workerPointer, _fd, bufferId, timeout ?? transportTimeoutInfinity);
+    _pending++;
+    return _connector.future;
+  }
+
+  @pragma(preferInlinePragma)
+  bool tryRead() {
+    if (_closing) return false;
+    final bufferId = _buffers.get();
+    if (bufferId == null) return false;
+    _read(bufferId);
+    return true;
+  }
+
+  @pragma(preferInlinePragma)
+  Future<void> read() => tryRead() ? transportCompleted : _readAsync();
+
+  Future<void> _readAsync() async {
+    final bufferId = _buffers.get() ?? await _buffers.allocate();
+    if (_closing) {
+      _buffers.release(bufferId);
+      return Future.error(TransportClosedException.forShared());
+    }
+    _read(bufferId);
+  }
+
+  @pragma(preferInlinePragma)
+  void _read(int bufferId) {
+    _readers.addLast(bufferId);
+    if (_readers.length == 1) _drainReaders();
+  }
+
+  void _drainReaders() {
+    while (_readers.isNotEmpty) {
+      final bufferId = _readers.first;
+      final result = _bindings.transport_shared_read(_pointer, _workerPointer, bufferId);
+      if (result == -EAGAIN) {
+        if (_bindings.transport_shared_wait_readable(_pointer, _workerPointer, bufferId, _readTimeout ?? transportTimeoutInfinity)) {
+          _pending++;
+          return;
+        }
+        continue;
+      }
+      _readers.removeFirst();
+      if (result > 0) {
+        _inboundEvents.add(_payloadPool.getPayload(bufferId, _buffers.read(bufferId)));
+        continue;
+      }
+      _buffers.release(bufferId);
+      if (result < 0) _inboundEvents.addError(createTransportException(TransportEvent.sharedRead, result, _bindings));
+      unawaited(close());
+      return;
+    }
+  }
+
+  @pragma(preferInlinePragma)
+  bool tryWriteSingle(Uint8List bytes, {void Function(Exception error)? onError, void Function()? onDone}) {
+    if (_closing) return false;
+    final bufferId = _buffers.get();
+    if (bufferId == null) return false;
+    _write(bufferId, bytes, onError, onDone);
+    return true;
+  }
+
+  @pragma(preferInlinePragma)
+  Future<void> writeSingle(Uint8List bytes, {void Function(Exception error)? onError, void Function()? onDone}) =>
+      tryWriteSingle(bytes, onError: onError, onDone: onDone) ? transportCompleted : _writeSingleAsync(bytes, onError, onDone);
+
+  Future<void> _writeSingleAsync(Uint8List bytes, void Function(Exception error)? onError, void Function()? onDone) async {
+    final bufferId = _buffers.get() ?? await _buffers.allocate();
+    if (_closing) {
+      _buffers.release(bufferId);
+      return Future.error(TransportClosedException.forShared());
+    }
+    _write(bufferId, bytes, onError, onDone);
+  }
+
+  Future<void> writeMany(List<Uint8List> bytes, {void Function(Exception error)? onError, void Function()? onDone}) async {
+    final bufferIds = await _buffers.allocateArray(bytes.length);
+    if (_closing) {
+      _buffers.releaseArray(bufferIds);
+      return Future.error(TransportClosedException.forShared());
+    }
+    for (var index = 0; index < bytes.length; index++) {
+      _write(bufferIds[index], bytes[index], onError, onDone);
+    }
+  }
+
+  @pragma(preferInlinePragma)
+  void _write(int bufferId, Uint8List bytes, void Function(Exception error)? onError, void Function()? onDone) {
+    _buffers.write(bufferId, bytes);
+    _callbacks.setOutbound(bufferId, onError, onDone);
+    _writers.addLast(bufferId);
+    if (_writers.length == 1) _drainWriters();
+  }
+
+  void _drainWriters() {
+    while (_writers.isNotEmpty) {
+      final bufferId = _writers.first;
+      final result = _bindings.transport_shared_write(_pointer, _workerPointer, bufferId);
+      if (result == -EAGAIN) {
+        if (_bindings.transport_shared_wait_writable(_pointer, _workerPointer, bufferId, _writeTimeout ?? transportTimeoutInfinity)) {
+          _pending++;
+          return;
+        }
+        continue;
+      }
+      _writers.removeFirst();
+      _buffers.release(bufferId);
+      if (result > 0) {
+        _callbacks.notifyDone(bufferId);
+        continue;
+      }
+      _callbacks.notifyError(bufferId, createTransportException(TransportEvent.sharedWrite, result, _bindings));
+      unawaited(close());
+      return;
+    }
+    if (_flusher != null && !_flusher!.isCompleted) _flusher!.complete();
+  }
+
+  void notify(int bufferId, int result, int event) {
+    _pending--;
+    if (_active) {
+      if (event == transportEventReceiveMessage) {
+        if (result > 0) result = result < sizeOf<Uint32>() ? -EPROTO : _bindings.transport_shared_attach(_pointer, _workerPointer, bufferId);
+        _buffers.release(bufferId);
+        if (result == 0 && _pointer.ref.memory != nullptr) {
+          _connector.complete();
+          return;
+        }
+        _connector.completeError(createTransportException(TransportEvent.sharedConnect, result, _bindings));
+        unawaited(close());
+        return;
+      }
+      if (result == 0 || result == -EAGAIN) {
+        if (event == transportEventRead) _drainReaders();
+        if (event == transportEventWrite) _drainWriters();
+        return;
+      }
+      final exception = createTransportException(TransportEvent.sharedEvent(event), result, _bindings);
+      if (event == transportEventRead && _readers.isNotEmpty) {
+        _buffers.release(_readers.removeFirst());
+        _inboundEvents.addError(exception);
+      }
+      if (event == transportEventWrite && _writers.isNotEmpty) {
+        final bufferId = _writers.removeFirst();
+        _buffers.release(bufferId);
+        _callbacks.notifyError(bufferId, exception);
+      }
+      unawaited(close());
+      return;
+    }
+    if (event == transportEventReceiveMessage) {
+      _buffers.release(bufferId);
+      _connector.completeError(TransportClosedException.forShared());
+    }
+    if (_pending == 0 && _closing && !_closer.isCompleted) _closer.complete();
+  }
+
+  Future<void> close({Duration? gracefulTimeout}) async {
+    if (_closing) {
+      if (!_closer.isCompleted) await _closer.future;
+      return;
+    }
+    _closing = true;
+    if (gracefulTimeout != null && _writers.isNotEmpty) {
+      _flusher = Completer();
+      await _flusher!.future.timeout(gracefulTimeout, onTimeout: () {});
+    }
+    _active = false;
+    if (_pending > 0) {
+      _bindings.transport_worker_cancel_by_fd(_workerPointer, _fd);
+      await _closer.future;
+    }
+    for (var bufferId in _readers) _buffers.release(bufferId);
+    for (var bufferId in _writers) {
+      _callbacks.clear(bufferId);
+      _buffers.release(bufferId);
+    }
+    _readers.clear();
+    _writers.clear();
+    _registry.remove(_fd);
+    _bindings.transport_shared_destroy(_pointer);
+    if (_inboundEvents.hasListener) await _inboundEvents.close();
+    if (!_closer.isCompleted) _closer.complete();
+  }
+}
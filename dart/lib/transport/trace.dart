@@ -0,0 +1,35 @@
+import 'dart:typed_data';
+
+import 'constants.dart';
+
+const transportTraceEntrySize = 24;
+
+class TransportTraceEntry {
+  final TransportTraceKind kind;
+  final int timestamp;
+  final int data;
+  final int result;
+
+  int get fd => (data >> 32) & 0xffffffff;
+  int get bufferId => (data >> 16) & 0xffff;
+  int get event => data & 0xffff;
+
+  const TransportTraceEntry(this.kind, this.timestamp, this.data, this.result);
+
+  @override
+  String toString() => TransportMessages.workerTrace(kind, timestamp, result, event, bufferId, fd);
+}
+
+List<TransportTraceEntry> decodeTransportTrace(Uint8List bytes) {
+  final view = ByteData.sublistView(bytes);
+  final entries = <TransportTraceEntry>[];
+  for (var offset = 0; offset + transportTraceEntrySize <= bytes.length; offset += transportTraceEntrySize) {
+    entries.add(TransportTraceEntry(
+      TransportTraceKind.values[view.getUint32(offset + 20, Endian.little)],
+      view.getUint64(offset, Endian.little),
+      view.getUint64(offset + 8, Endian.little),
+      view.getInt32(offset + 16, Endian.little),
+    ));
+  }
+  return entries;
+}
@@ -44,7 +44,10 @@ class Transport {
         nativeConfiguration.ref.ring_flags = configuration.ringFlags;
         nativeConfiguration.ref.ring_size = configuration.ringSize;
         nativeConfiguration.ref.buffer_size = configuration.bufferSize;
-        nativeConfiguration.ref.buffers_count = max(configuration.buffersCount, 2);
+        nativeConfiguration.ref.buffers_count = min(max(configuration.buffersCount, 2), transportBuffersMaxCount);
+        nativeConfiguration.ref.buffers_max_count = min(configuration.buffersMaxCount, transportBuffersMaxCount);
+        nativeConfiguration.ref.buffers_grow_occupancy = configuration.buffersGrowOccupancy;
+        nativeConfiguration.ref.buffers_shrink_occupancy = configuration.buffersShrinkOccupancy;
         nativeConfiguration.ref.timeout_checker_period_millis = configuration.timeoutCheckerPeriod.inMilliseconds;
         nativeConfiguration.ref.base_delay_micros = configuration.baseDelay.inMicroseconds;
         nativeConfiguration.ref.max_delay_micros = configuration.maxDelay.inMicroseconds;
@@ -53,6 +56,7 @@ class Transport {
         nativeConfiguration.ref.cqe_wait_count = configuration.cqeWaitCount;
         nativeConfiguration.ref.cqe_wait_timeout_millis = configuration.cqeWaitTimeout.inMilliseconds;
         nativeConfiguration.ref.trace = configuration.trace;
+        nativeConfiguration.ref.trace_capacity = configuration.traceCapacity;
         return _bindings.transport_worker_initialize(workerPointer, nativeConfiguration, _workerClosers.length);
       });
       if (result < 0) {
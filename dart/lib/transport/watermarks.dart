@@ -0,0 +1,42 @@
+import 'dart:async';
+
+import 'constants.dart';
+
+class TransportOutboundWatermarks {
+  final int? _high;
+  final int _low;
+
+  var _outbound = 0;
+  Completer<void>? _paused;
+
+  int get outbound => _outbound;
+  bool get writable => _paused == null;
+
+  TransportOutboundWatermarks(this._high, int? low) : _low = low ?? (_high ?? 0) ~/ 2;
+
+  @pragma(preferInlinePragma)
+  Future<void> whenWritable() => _paused?.future ?? Future.value();
+
+  @pragma(preferInlinePragma)
+  void acquire(int count) {
+    _outbound += count;
+    if (_high != null && _paused == null && _outbound >= _high!) _paused = Completer();
+  }
+
+  @pragma(preferInlinePragma)
+  void release() {
+    _outbound--;
+    if (_paused != null && _outbound <= _low) _resume();
+  }
+
+  @pragma(preferInlinePragma)
+  void reset() {
+    if (_paused != null) _resume();
+  }
+
+  void _resume() {
+    final paused = _paused!;
+    _paused = null;
+    paused.complete();
+  }
+}
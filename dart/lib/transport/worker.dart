@@ -2,7 +2,9 @@ import 'dart:async';
 import 'dart:ffi';
 import 'dart:isolate';
 import 'dart:math';
+import 'dart:typed_data';
 
+import 'package:ffi/ffi.dart';
 import 'package:meta/meta.dart';
 
 import 'bindings.dart';
@@ -12,12 +14,19 @@ import 'client/registry.dart';
 import 'constants.dart';
 import 'file/factory.dart';
 import 'file/registry.dart';
+import 'handles.dart';
+import 'latency.dart';
 import 'lookup.dart';
+import 'messenger.dart';
+import 'metrics.dart';
 import 'payload.dart';
 import 'server/factory.dart';
 import 'server/registry.dart';
 import 'server/responder.dart';
+import 'shared/factory.dart';
+import 'shared/registry.dart';
 import 'timeout.dart';
+import 'trace.dart';
 
 class TransportWorker {
   final _fromTransport = ReceivePort();
@@ -28,17 +37,23 @@ class TransportWorker {
   late final Pointer<Pointer<io_uring_cqe>> _cqes;
   late final RawReceivePort _closer;
   late final SendPort _destroyer;
+  late final TransportHandles _handles;
   late final TransportClientRegistry _clientRegistry;
   late final TransportServerRegistry _serverRegistry;
   late final TransportClientsFactory _clientsFactory;
   late final TransportServersFactory _serversFactory;
   late final TransportFileRegistry _filesRegistry;
   late final TransportFilesFactory _filesFactory;
+  late final TransportSharedRegistry _sharedRegistry;
+  late final TransportSharedFactory _sharedFactory;
   late final TransportBuffers _buffers;
   late final TransportTimeoutChecker _timeoutChecker;
   late final TransportPayloadPool _payloadPool;
   late final TransportServerDatagramResponderPool _datagramResponderPool;
   late final List<Duration> _delays;
+  late final TransportWorkerMetrics _metrics;
+  late final Pointer<transport_histogram_t> _latencies;
+  late final TransportMessenger _messenger;
 
   var _active = true;
   final _done = Completer();
@@ -49,16 +64,22 @@ class TransportWorker {
   TransportServersFactory get servers => _serversFactory;
   TransportClientsFactory get clients => _clientsFactory;
   TransportFilesFactory get files => _filesFactory;
+  TransportSharedFactory get shared => _sharedFactory;
+  TransportWorkerMetrics get metrics => _metrics;
+  TransportMessenger get messenger => _messenger;
 
   TransportWorker(SendPort toTransport) {
     _closer = RawReceivePort((gracefulTimeout) async {
       _timeoutChecker.stop();
+      await _messenger.close();
       await _filesRegistry.close(gracefulTimeout: gracefulTimeout);
       await _clientRegistry.close(gracefulTimeout: gracefulTimeout);
+      await _sharedRegistry.close(gracefulTimeout: gracefulTimeout);
       await _serverRegistry.close(gracefulTimeout: gracefulTimeout);
       _active = false;
       await _done.future;
       _bindings.transport_worker_destroy(_workerPointer);
+      calloc.free(_latencies);
       _closer.close();
       _destroyer.send(null);
     });
@@ -79,8 +100,9 @@ class TransportWorker {
     );
     _payloadPool = TransportPayloadPool(_workerPointer.ref.buffers_count, _buffers);
     _datagramResponderPool = TransportServerDatagramResponderPool(_workerPointer.ref.buffers_count, _buffers);
-    _clientRegistry = TransportClientRegistry();
-    _serverRegistry = TransportServerRegistry();
+    _handles = TransportHandles(_bindings, _workerPointer);
+    _clientRegistry = TransportClientRegistry(_handles);
+    _serverRegistry = TransportServerRegistry(_handles);
     _serversFactory = TransportServersFactory(
       _serverRegistry,
       _bindings,
@@ -96,7 +118,7 @@ class TransportWorker {
       _buffers,
       _payloadPool,
     );
-    _filesRegistry = TransportFileRegistry();
+    _filesRegistry = TransportFileRegistry(_handles);
     _filesFactory = TransportFilesFactory(
       _filesRegistry,
       _bindings,
@@ -104,8 +126,20 @@ class TransportWorker {
       _buffers,
       _payloadPool,
     );
+    _sharedRegistry = TransportSharedRegistry(_handles);
+    _sharedFactory = TransportSharedFactory(
+      _sharedRegistry,
+      _bindings,
+      _workerPointer,
+      _buffers,
+      _payloadPool,
+      _serversFactory,
+    );
     _ring = _workerPointer.ref.ring;
     _cqes = _workerPointer.ref.cqes;
+    _metrics = TransportWorkerMetrics(_workerPointer.ref.metrics);
+    _latencies = calloc<transport_histogram_t>(TransportOperation.values.length);
+    _messenger = TransportMessenger(_bindings, _workerPointer);
     _timeoutChecker = TransportTimeoutChecker(
       _bindings,
       _workerPointer,
@@ -137,47 +171,110 @@ class TransportWorker {
     if (cqeCount == 0) return false;
     for (var cqeIndex = 0; cqeIndex < cqeCount; cqeIndex++) {
       final cqe = _cqes.elementAt(cqeIndex).value;
-      final data = cqe.ref.user_data;
-      _bindings.transport_worker_remove_event(_workerPointer, data);
+      final data = _bindings.transport_worker_remove_event(_workerPointer, cqe.ref.user_data);
+      if (data == 0) continue;
       final result = cqe.ref.res;
       var event = data & 0xffff;
-      final fd = (data >> 32) & 0xffffffff;
+      final handle = (data >> 32) & 0xffffffff;
       final bufferId = (data >> 16) & 0xffff;
-      if (_workerPointer.ref.trace) print(TransportMessages.workerTrace(id, result, data, fd));
+
+      if (event & transportEventMessage != 0) {
+        _messenger.notify(handle, bufferId, result, event & ~transportEventMessage);
+        continue;
+      }
+
+      if (event & transportEventShared != 0) {
+        final channel = _sharedRegistry.get(handle);
+        if (channel == null) {
+          _metrics.recordUnrouted();
+          continue;
+        }
+        channel.notify(bufferId, result, event & ~transportEventShared);
+        continue;
+      }
+
+      if (event == transportEventSocket) {
+        _clientRegistry.notifySocket(handle, result);
+        continue;
+      }
 
       if (event & transportEventClient != 0) {
+        final client = _clientRegistry.get(handle);
+        if (client == null) {
+          _metrics.recordUnrouted();
+          continue;
+        }
         event &= ~transportEventClient;
+        if (event == transportEventSocket) {
+          client.notifyOption(bufferId);
+          continue;
+        }
         if (event == transportEventConnect) {
-          _clientRegistry.get(fd)?.notifyConnect(fd, result);
+          client.notifyConnect(result);
           continue;
         }
-        _clientRegistry.get(fd)?.notifyData(bufferId, result, event);
+        client.notifyData(bufferId, result, event);
         continue;
       }
 
       if (event & transportEventServer != 0) {
         event &= ~transportEventServer;
         if (event == transportEventRead || event == transportEventWrite) {
-          _serverRegistry.getConnection(fd)?.notify(bufferId, result, event);
+          final connection = _serverRegistry.getConnection(handle);
+          if (connection == null) {
+            _metrics.recordUnrouted();
+            continue;
+          }
+          connection.notify(bufferId, result, event);
+          continue;
+        }
+        final server = _serverRegistry.getServer(handle);
+        if (server == null) {
+          _metrics.recordUnrouted();
           continue;
         }
         if (event == transportEventReceiveMessage || event == transportEventSendMessage) {
-          _serverRegistry.getServer(fd)?.notifyDatagram(bufferId, result, event);
+          server.notifyDatagram(bufferId, result, event);
           continue;
         }
-        _serverRegistry.getServer(fd)?.notifyAccept(result);
+        server.notifyAccept(result);
         continue;
       }
 
       if (event & transportEventFile != 0) {
-        _filesRegistry.get(fd)?.notify(bufferId, result, event & ~transportEventFile);
+        final file = _filesRegistry.get(handle);
+        if (file == null) {
+          _metrics.recordUnrouted();
+          continue;
+        }
+        file.notify(bufferId, result, event & ~transportEventFile);
         continue;
       }
+
+      _metrics.recordUnrouted();
     }
     _bindings.transport_cqe_advance(_ring, cqeCount);
     return true;
   }
 
+  TransportLatencies latencies({bool reset = false}) {
+    _bindings.transport_worker_snapshot_latencies(_workerPointer, _latencies, reset);
+    return TransportLatencies.fromNative(_latencies);
+  }
+
+  Uint8List dumpTrace() {
+    final capacity = _workerPointer.ref.trace_ring.entries == nullptr ? 0 : _workerPointer.ref.trace_ring.mask + 1;
+    if (capacity == 0) return Uint8List(0);
+    final target = calloc<transport_trace_entry_t>(capacity);
+    final count = _bindings.transport_worker_dump_trace(_workerPointer, target, capacity);
+    final bytes = Uint8List.fromList(target.cast<Uint8>().asTypedList(count * transportTraceEntrySize));
+    calloc.free(target);
+    return bytes;
+  }
+
+  @pragma(preferInlinePragma)
+  List<TransportTraceEntry> trace() => decodeTransportTrace(dumpTrace());
+
   List<Duration> _calculateDelays() {
     final baseDelay = _workerPointer.ref.base_delay_micros;
     final delayRandomizationFactor = _workerPointer.ref.delay_randomization_factor;
@@ -195,4 +292,10 @@ class TransportWorker {
 
   @visibleForTesting
   TransportBuffers get buffers => _buffers;
+
+  @visibleForTesting
+  TransportBindings get bindings => _bindings;
+
+  @visibleForTesting
+  Pointer<transport_worker_t> get pointer => _workerPointer;
 }
@@ -1,99 +1,494 @@
 import 'dart:async';
+import 'dart:collection';
 import 'dart:convert';
 import 'dart:io';
 import 'dart:isolate';
+import 'dart:typed_data';
 
+import 'package:iouring_transport/iouring_transport.dart';
 import 'package:iouring_transport/transport/configuration.dart';
+import 'package:iouring_transport/transport/constants.dart';
 import 'package:iouring_transport/transport/defaults.dart';
 import 'package:iouring_transport/transport/transport.dart';
 import 'package:iouring_transport/transport/worker.dart';
 
+const _histogramSubBuckets = 16;
+const _histogramBuckets = (64 - 4 + 1) * _histogramSubBuckets;
+const _basePort = 12345;
+const _clockTicksPerSecond = 100;
+
+final _clock = Stopwatch()..start();
+
 Future<void> main(List<String> args) async {
-  await _benchMyTcp();
-  await _benchDartTcp();
+  final options = _BenchmarkOptions.parse(args);
+  final results = <Map<String, dynamic>>[];
+  for (final protocol in options.protocols) {
+    for (final payloadSize in options.payloadSizes) {
+      for (final connections in options.connections) {
+        for (final workers in options.workers) {
+          for (final sqpoll in options.sqpoll) {
+            for (final rate in options.rates) {
+              final scenario = _BenchmarkScenario(protocol, payloadSize, connections, workers, sqpoll, rate, options.warmup, options.duration);
+              stderr.writeln("[benchmark] $scenario");
+              results.add(await _run(scenario));
+            }
+          }
+        }
+      }
+    }
+  }
+  final json = JsonEncoder.withIndent("  ").convert({
+    "timestamp": DateTime.now().toUtc().toIso8601String(),
+    "dart": Platform.version,
+    "results": results,
+  });
+  if (options.output == null) {
+    stdout.writeln(json);
+    return;
+  }
+  await File(options.output!).writeAsString(json);
 }
 
-Future<void> _benchMyTcp() async {
-  final transport = Transport();
-  final encoder = Utf8Encoder();
-  final fromServer = encoder.convert("from server\n");
-
-  for (var i = 0; i < 2; i++) {
-    Isolate.spawn((SendPort message) async {
-      final worker = TransportWorker(message);
-      await worker.initialize();
-      worker.servers.tcp(
-        InternetAddress("0.0.0.0"),
-        12345,
-        (connection) => connection.stream().listen((payload) {
-          payload.release();
-          connection.writeSingle(fromServer);
-        }),
+class _BenchmarkOptions {
+  final List<String> protocols;
+  final List<int> payloadSizes;
+  final List<int> connections;
+  final List<int> workers;
+  final List<bool> sqpoll;
+  final List<int> rates;
+  final Duration warmup;
+  final Duration duration;
+  final String? output;
+
+  _BenchmarkOptions(this.protocols, this.payloadSizes, this.connections, this.workers, this.sqpoll, this.rates, this.warmup, this.duration, this.output);
+
+  factory _BenchmarkOptions.parse(List<String> args) {
+    final values = <String, String>{};
+    for (final argument in args) {
+      if (!argument.startsWith("--") || !argument.contains("=")) {
+        stderr.writeln("Usage: dart test/benchmark.dart [--protocols=tcp,udp,unix,file,dartio] [--payloads=64,1024] [--connections=1,64] "
+            "[--workers=1,2] [--sqpoll=false,true] [--rates=0,10000,100000] [--warmup=1] [--duration=5] [--output=results.json]");
+        exit(1);
+      }
+      final separator = argument.indexOf("=");
+      values[argument.substring(2, separator)] = argument.substring(separator + 1);
+    }
+    List<String> list(String key, String fallback) => (values[key] ?? fallback).split(",").where((value) => value.isNotEmpty).toList();
+    return _BenchmarkOptions(
+      list("protocols", "tcp,udp,unix,file"),
+      list("payloads", "64,1024,4096").map(int.parse).toList(),
+      list("connections", "1,64,256").map(int.parse).toList(),
+      list("workers", "1,2").map(int.parse).toList(),
+      list("sqpoll", "false,true").map((value) => value == "true").toList(),
+      list("rates", "0").map(int.parse).toList(),
+      Duration(seconds: int.parse(values["warmup"] ?? "1")),
+      Duration(seconds: int.parse(values["duration"] ?? "5")),
+      values["output"],
+    );
+  }
+}
+
+class _BenchmarkScenario {
+  final String protocol;
+  final int payloadSize;
+  final int connections;
+  final int workers;
+  final bool sqpoll;
+  final int rate;
+  final Duration warmup;
+  final Duration duration;
+
+  _BenchmarkScenario(this.protocol, this.payloadSize, this.connections, this.workers, this.sqpoll, this.rate, this.warmup, this.duration);
+
+  int get bufferSize => payloadSize > 4096 ? payloadSize : 4096;
+
+  TransportWorkerConfiguration get worker => TransportDefaults.worker().copyWith(
+        bufferSize: bufferSize,
+        buffersCount: connections * 4 + 64,
+        ringFlags: sqpoll ? ringSetupSqpoll : 0,
       );
-    }, transport.worker(TransportDefaults.worker().copyWith(ringFlags: ringSetupSqpoll)));
-  }
-  await Future.delayed(Duration(seconds: 1));
-  for (var i = 0; i < 2; i++) {
-    Isolate.spawn((SendPort message) async {
-      final worker = TransportWorker(message);
-      await worker.initialize();
-      final connector = await worker.clients.tcp(InternetAddress("127.0.0.1"), 12345, configuration: TransportDefaults.tcpClient().copyWith(pool: 256));
-      var count = 0;
-      final time = Stopwatch();
-      time.start();
-      for (var client in connector.clients) {
-        client.stream().listen((element) {
-          count++;
-          element.release();
-          client.writeSingle(fromServer);
-        });
-        client.writeSingle(fromServer);
+
+  Map<String, dynamic> toJson() => {
+        "protocol": protocol,
+        "payloadSize": payloadSize,
+        "connections": connections,
+        "workers": workers,
+        "sqpoll": sqpoll,
+        "mode": rate > 0 ? "open" : "closed",
+        "targetRate": rate,
+        "bufferSize": bufferSize,
+        "warmupSeconds": warmup.inSeconds,
+        "durationSeconds": duration.inSeconds,
+      };
+
+  @override
+  String toString() => "protocol = $protocol, payload = $payloadSize, connections = $connections, workers = $workers, sqpoll = $sqpoll, rate = ${rate > 0 ? rate : "closed"}";
+}
+
+class _BenchmarkHistogram {
+  final buckets = List.filled(_histogramBuckets, 0);
+  var count = 0;
+  var sum = 0;
+  var min = 0;
+  var max = 0;
+
+  void record(int nanos) {
+    buckets[_index(nanos)]++;
+    if (count == 0 || nanos < min) min = nanos;
+    if (nanos > max) max = nanos;
+    count++;
+    sum += nanos;
+  }
+
+  void reset() {
+    buckets.fillRange(0, _histogramBuckets, 0);
+    count = sum = min = max = 0;
+  }
+
+  void merge(List<dynamic> encoded) {
+    final otherCount = encoded[0] as int;
+    if (otherCount == 0) return;
+    final otherMin = encoded[2] as int;
+    final otherMax = encoded[3] as int;
+    min = count == 0 || otherMin < min ? otherMin : min;
+    max = otherMax > max ? otherMax : max;
+    count += otherCount;
+    sum += encoded[1] as int;
+    final otherBuckets = encoded[4] as List<int>;
+    for (var index = 0; index < _histogramBuckets; index++) {
+      buckets[index] += otherBuckets[index];
+    }
+  }
+
+  List<dynamic> encode() => [count, sum, min, max, buckets];
+
+  int percentile(double quantile) {
+    if (count == 0) return 0;
+    final rank = (quantile * count).ceil().clamp(1, count);
+    var cumulative = 0;
+    for (var index = 0; index < _histogramBuckets; index++) {
+      cumulative += buckets[index];
+      if (cumulative >= rank) return _upperBound(index).clamp(min, max);
+    }
+    return max;
+  }
+
+  Map<String, double> toJson() => {
+        "min": min / 1000,
+        "p50": percentile(0.5) / 1000,
+        "p90": percentile(0.9) / 1000,
+        "p99": percentile(0.99) / 1000,
+        "p999": percentile(0.999) / 1000,
+        "max": max / 1000,
+        "mean": count == 0 ? 0.0 : sum / count / 1000,
+      };
+
+  static int _index(int value) {
+    if (value < _histogramSubBuckets) return value;
+    final shift = value.bitLength - 1 - 4;
+    return (shift + 1) * _histogramSubBuckets + ((value >> shift) & (_histogramSubBuckets - 1));
+  }
+
+  static int _upperBound(int index) {
+    if (index < _histogramSubBuckets) return index;
+    final shift = index ~/ _histogramSubBuckets - 1;
+    final upper = ((_histogramSubBuckets + index % _histogramSubBuckets + 1) << shift) - 1;
+    return upper < 0 ? 0x7fffffffffffffff : upper;
+  }
+}
+
+class _BenchmarkProbe {
+  final int userTicks;
+  final int systemTicks;
+  final int microseconds;
+
+  _BenchmarkProbe(this.userTicks, this.systemTicks, this.microseconds);
+
+  factory _BenchmarkProbe.now() {
+    final stat = File("/proc/self/stat").readAsStringSync();
+    final fields = stat.substring(stat.lastIndexOf(")") + 2).split(" ");
+    return _BenchmarkProbe(int.parse(fields[11]), int.parse(fields[12]), _clock.elapsedMicroseconds);
+  }
+}
+
+Future<Map<String, dynamic>> _run(_BenchmarkScenario scenario) async {
+  final transport = Transport();
+  final fromWorkers = ReceivePort();
+  final messages = StreamIterator(fromWorkers);
+  final controls = <SendPort>[];
+  final file = scenario.protocol == "file" ? await _createFile(scenario.payloadSize) : null;
+  for (var workerIndex = 0; workerIndex < scenario.workers; workerIndex++) {
+    final perWorker = scenario.connections ~/ scenario.workers + (workerIndex < scenario.connections % scenario.workers ? 1 : 0);
+    await Isolate.spawn(_worker, [
+      transport.worker(scenario.worker),
+      fromWorkers.sendPort,
+      scenario.protocol,
+      scenario.payloadSize,
+      perWorker,
+      workerIndex,
+      file?.path,
+      scenario.rate / scenario.workers,
+    ]);
+  }
+  for (var workerIndex = 0; workerIndex < scenario.workers; workerIndex++) {
+    await messages.moveNext();
+    controls.add(messages.current as SendPort);
+  }
+  await Future.delayed(scenario.warmup);
+  controls.forEach((control) => control.send(true));
+  final start = _BenchmarkProbe.now();
+  await Future.delayed(scenario.duration);
+  final end = _BenchmarkProbe.now();
+  final rss = ProcessInfo.currentRss;
+  controls.forEach((control) => control.send(false));
+
+  final histogram = _BenchmarkHistogram();
+  final native = <String, Map<String, dynamic>>{};
+  var completed = 0;
+  var issued = 0;
+  var outstanding = 0;
+  for (var workerIndex = 0; workerIndex < scenario.workers; workerIndex++) {
+    await messages.moveNext();
+    final result = messages.current as List;
+    completed += result[0] as int;
+    histogram.merge(result[1] as List);
+    (result[2] as Map).forEach((operation, latencies) => native.putIfAbsent(operation as String, () => {}).addAll({"worker${workerIndex}": latencies}));
+    issued += result[3] as int;
+    outstanding += result[4] as int;
+  }
+  await messages.cancel();
+  await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  if (file != null) await file.parent.delete(recursive: true);
+
+  final seconds = (end.microseconds - start.microseconds) / Duration.microsecondsPerSecond;
+  return {
+    ...scenario.toJson(),
+    "messages": completed,
+    "issued": issued,
+    "outstanding": outstanding,
+    "throughput": {
+      "messagesPerSecond": completed / seconds,
+      "bytesPerSecond": completed * scenario.payloadSize / seconds,
+    },
+    "latencyMicros": histogram.toJson(),
+    "nativeLatencyMicros": native,
+    "cpuSeconds": {
+      "user": (end.userTicks - start.userTicks) / _clockTicksPerSecond,
+      "system": (end.systemTicks - start.systemTicks) / _clockTicksPerSecond,
+    },
+    "rssBytes": {
+      "current": rss,
+      "max": ProcessInfo.maxRss,
+    },
+  };
+}
+
+Future<File> _createFile(int size) async {
+  final directory = await Directory.systemTemp.createTemp("transport_benchmark");
+  final file = File("${directory.path}/payload");
+  await file.writeAsBytes(Uint8List(size)..fillRange(0, size, 0x78));
+  return file;
+}
+
+class _BenchmarkChannel {
+  final void Function() _send;
+  final _intended = Queue<int>();
+  var _received = 0;
+
+  _BenchmarkChannel(this._send);
+
+  int get outstanding => _intended.length;
+
+  void send(int intended) {
+    _intended.add(intended);
+    _send();
+  }
+
+  List<int> receive(int bytes, int messageSize) {
+    final completed = <int>[];
+    _received += bytes;
+    while (_received >= messageSize && _intended.isNotEmpty) {
+      _received -= messageSize;
+      completed.add(_intended.removeFirst());
+    }
+    return completed;
+  }
+
+  Iterable<int> drain() sync* {
+    while (_intended.isNotEmpty) yield _intended.removeFirst();
+  }
+}
+
+class _BenchmarkLoad {
+  final double rate;
+  final _BenchmarkHistogram histogram = _BenchmarkHistogram();
+  final channels = <_BenchmarkChannel>[];
+  var completed = 0;
+  var issued = 0;
+  var measuring = false;
+  var running = true;
+  var _next = 0;
+  var _issuedBase = 0;
+  var _scheduleStart = 0;
+  Timer? _scheduler;
+
+  _BenchmarkLoad(this.rate);
+
+  bool get open => rate > 0;
+  int get measuredIssued => issued - _issuedBase;
+
+  void start() {
+    if (!open) {
+      final now = _clock.elapsedMicroseconds;
+      channels.forEach((channel) => channel.send(now));
+      issued += channels.length;
+      return;
+    }
+    _scheduleStart = _clock.elapsedMicroseconds;
+    _scheduler = Timer.periodic(Duration(milliseconds: 1), (_) => _tick());
+  }
+
+  void _tick() {
+    final due = ((_clock.elapsedMicroseconds - _scheduleStart) * rate / Duration.microsecondsPerSecond).floor();
+    while (running && issued < due) {
+      final intended = _scheduleStart + (issued * Duration.microsecondsPerSecond / rate).round();
+      channels[_next].send(intended);
+      _next = (_next + 1) % channels.length;
+      issued++;
+    }
+  }
+
+  void respond(_BenchmarkChannel channel, int bytes, int messageSize) {
+    final now = _clock.elapsedMicroseconds;
+    for (final intended in channel.receive(bytes, messageSize)) {
+      if (measuring) {
+        histogram.record((now - intended) * 1000);
+        completed++;
+      }
+      if (!open && running) {
+        channel.send(_clock.elapsedMicroseconds);
+        issued++;
       }
-      await Future.delayed(Duration(seconds: 10));
-      print("My RPS: ${count / 10}");
-    }, transport.worker(TransportDefaults.worker()));
+    }
+  }
+
+  void measure() {
+    histogram.reset();
+    completed = 0;
+    _issuedBase = issued;
+    measuring = true;
   }
 
-  await Future.delayed(Duration(seconds: 15));
-  await transport.shutdown();
+  int stop() {
+    running = false;
+    measuring = false;
+    _scheduler?.cancel();
+    final now = _clock.elapsedMicroseconds;
+    var outstanding = 0;
+    for (final channel in channels) {
+      for (final intended in channel.drain()) {
+        if (open) histogram.record((now - intended) * 1000);
+        outstanding++;
+      }
+    }
+    return outstanding;
+  }
 }
 
-Future<void> _benchDartTcp() async {
-  final encoder = Utf8Encoder();
-  final fromServer = encoder.convert("from server\n");
-
-  for (var i = 0; i < 2; i++) {
-    Isolate.spawn((_) async {
-      ServerSocket.bind(InternetAddress("127.0.0.1"), 2345, shared: true).then((server) {
-        server.listen((client) {
-          client.listen((event) {
-            client.write(fromServer);
-          });
+Future<void> _worker(List<dynamic> input) async {
+  final toMain = input[1] as SendPort;
+  final protocol = input[2] as String;
+  final payloadSize = input[3] as int;
+  final connections = input[4] as int;
+  final workerIndex = input[5] as int;
+  final filePath = input[6] as String?;
+  final load = _BenchmarkLoad(input[7] as double);
+  final worker = TransportWorker(input[0] as SendPort);
+  await worker.initialize();
+  final payload = Uint8List(payloadSize)..fillRange(0, payloadSize, 0x78);
+
+  final port = _basePort + workerIndex;
+  switch (protocol) {
+    case "tcp":
+    case "unix":
+      final path = "${Directory.systemTemp.path}/transport_benchmark_$workerIndex.sock";
+      void onAccept(TransportServerConnection connection) => connection.stream().listen((event) => connection.writeSingle(event.takeBytes()));
+      if (protocol == "tcp") {
+        worker.servers.tcp(InternetAddress.loopbackIPv4, port, onAccept);
+      } else {
+        if (File(path).existsSync()) File(path).deleteSync();
+        worker.servers.unixStream(path, onAccept);
+      }
+      final pool = protocol == "tcp"
+          ? await worker.clients.tcp(InternetAddress.loopbackIPv4, port, configuration: TransportDefaults.tcpClient().copyWith(pool: connections))
+          : await worker.clients.unixStream(path, configuration: TransportDefaults.unixStreamClient().copyWith(pool: connections));
+      for (final client in pool.clients) {
+        final channel = _BenchmarkChannel(() => client.writeSingle(payload));
+        client.stream().listen((event) {
+          final bytes = event.bytes.length;
+          event.release();
+          load.respond(channel, bytes, payloadSize);
         });
-      });
-    }, null);
-  }
-  await Future.delayed(Duration(seconds: 1));
-  for (var i = 0; i < 2; i++) {
-    Isolate.spawn((_) async {
-      final sockets = <Socket>[];
-      for (var i = 0; i < 256; i++) {
-        sockets.add(await Socket.connect("127.0.0.1", 2345));
+        load.channels.add(channel);
       }
-      var count = 0;
-      final time = Stopwatch();
-      time.start();
-      for (var client in sockets) {
-        client.listen((element) {
-          count++;
-          client.write(fromServer);
+    case "udp":
+      worker.servers.udp(InternetAddress.loopbackIPv4, port).stream().listen((responder) => responder.respondSingle(responder.takeBytes()));
+      for (var clientIndex = 0; clientIndex < connections; clientIndex++) {
+        final client = worker.clients.udp(InternetAddress.loopbackIPv4, port + (workerIndex + 1) * 1000 + clientIndex, InternetAddress.loopbackIPv4, port);
+        final channel = _BenchmarkChannel(() => client.sendSingle(payload));
+        client.stream().listen((event) {
+          event.release();
+          load.respond(channel, payloadSize, payloadSize);
         });
-        client.write(fromServer);
+        load.channels.add(channel);
       }
-      await Future.delayed(Duration(seconds: 10));
-      print("Dart RPS: ${count / 10}");
-    }, null);
+    case "file":
+      for (var fileIndex = 0; fileIndex < connections; fileIndex++) {
+        final file = worker.files.open(filePath!, mode: TransportFileMode.readOnly);
+        final channel = _BenchmarkChannel(() => file.read());
+        file.inbound.listen((event) {
+          event.release();
+          load.respond(channel, payloadSize, payloadSize);
+        });
+        load.channels.add(channel);
+      }
+    case "dartio":
+      final server = await ServerSocket.bind(InternetAddress.loopbackIPv4, port, shared: true);
+      server.listen((socket) {
+        socket.setOption(SocketOption.tcpNoDelay, true);
+        socket.listen(socket.add);
+      });
+      for (var clientIndex = 0; clientIndex < connections; clientIndex++) {
+        final socket = await Socket.connect(InternetAddress.loopbackIPv4, port);
+        socket.setOption(SocketOption.tcpNoDelay, true);
+        final channel = _BenchmarkChannel(() => socket.add(payload));
+        socket.listen((event) => load.respond(channel, event.length, payloadSize));
+        load.channels.add(channel);
+      }
+    default:
+      throw ArgumentError.value(protocol, "protocol");
   }
+  load.start();
 
-  await Future.delayed(Duration(seconds: 15));
+  final control = ReceivePort();
+  toMain.send(control.sendPort);
+  await for (final start in control) {
+    if (start as bool) {
+      worker.latencies(reset: true);
+      load.measure();
+      continue;
+    }
+    final outstanding = load.stop();
+    final native = <String, dynamic>{};
+    for (final entry in worker.latencies().entries.where((entry) => entry.value.count > 0)) {
+      native[entry.key.name] = {
+        "count": entry.value.count,
+        "p50": entry.value.percentileNanos(0.5) / 1000,
+        "p99": entry.value.percentileNanos(0.99) / 1000,
+        "p999": entry.value.percentileNanos(0.999) / 1000,
+      };
+    }
+    toMain.send([load.completed, load.histogram.encode(), native, load.measuredIssued, outstanding]);
+    control.close();
+  }
 }
@@ -201,3 +201,65 @@ void testBuffersOverflow() {
     await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
   });
 }
+
+void testBuffersCallbacks() {
+  test("(callbacks)", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker().copyWith(buffersCount: 4)));
+    await worker.initialize();
+
+    final received = BytesBuilder();
+    final receivedCompleter = Completer();
+    worker.servers.tcp(io.InternetAddress("0.0.0.0"), 12345, (connection) {
+      connection.stream().listen((value) {
+        received.add(value.takeBytes());
+        if (received.length == Generators.requestsSumUnordered(16).length) receivedCompleter.complete();
+      });
+    });
+    final clients = await worker.clients.tcp(io.InternetAddress("127.0.0.1"), 12345);
+    final done = List.filled(16, 0);
+    final doneCompleter = Completer();
+    var doneCount = 0;
+    for (var index = 0; index < 16; index++) {
+      clients.select().writeSingle(Generators.request(), onDone: () {
+        done[index]++;
+        if (++doneCount == 16) doneCompleter.complete();
+      });
+    }
+    await doneCompleter.future;
+    await receivedCompleter.future;
+    Validators.requestsSumUnordered(received.takeBytes(), 16);
+    if (done.any((count) => count != 1)) throw TestFailure("actual: $done");
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
+
+void testBuffersGrowth() {
+  test("(growth)", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker().copyWith(buffersCount: 4, buffersMaxCount: 64)));
+    await worker.initialize();
+
+    worker.servers.tcp(io.InternetAddress("0.0.0.0"), 12345, (connection) {
+      connection.stream().listen((value) {
+        value.release();
+        for (var index = 0; index < 32; index++) connection.writeSingle(Generators.response());
+      });
+    });
+    var clients = await worker.clients.tcp(io.InternetAddress("127.0.0.1"), 12345);
+    clients.select().writeSingle(Generators.request());
+    final bytes = BytesBuilder();
+    final completer = Completer();
+    clients.select().stream().listen((value) {
+      bytes.add(value.takeBytes());
+      if (bytes.length == Generators.responsesSumUnordered(32).length) {
+        completer.complete();
+      }
+    });
+    await completer.future;
+    Validators.responsesSumUnordered(bytes.takeBytes(), 32);
+    if (worker.buffers.buffersCount <= 4) throw TestFailure("actual: ${worker.buffers.buffersCount}");
+    if (worker.buffers.buffersCount > 64) throw TestFailure("actual: ${worker.buffers.buffersCount}");
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
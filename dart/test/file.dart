@@ -1,6 +1,8 @@
 import 'dart:async';
 import 'dart:io';
 
+import 'package:iouring_transport/transport/bindings.dart';
+import 'package:iouring_transport/transport/constants.dart';
 import 'package:iouring_transport/transport/defaults.dart';
 import 'package:iouring_transport/transport/transport.dart';
 import 'package:iouring_transport/transport/worker.dart';
@@ -47,3 +49,130 @@ void testFileLoad({required int index, required int count}) {
     await transport.shutdown();
   });
 }
+
+void testFileAppend({required int index, required int count}) {
+  test("(append) [index = $index, count = $count]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await worker.initialize();
+    var nativeFile = File("file-${worker.id}");
+    if (nativeFile.existsSync()) nativeFile.deleteSync();
+    if (!nativeFile.existsSync()) nativeFile.createSync();
+    final file = worker.files.open(nativeFile.path, create: true);
+    final appender = await file.appender(preallocationSize: 1024 * 1024);
+    await Future.wait(Generators.requestsOrdered(count).map(appender.append));
+    expect(appender.position, Generators.requestsSumOrdered(count).length);
+    Validators.requestsSumOrdered(await file.load(), count);
+    await file.close();
+    if (nativeFile.existsSync()) nativeFile.deleteSync();
+    await transport.shutdown();
+  });
+}
+
+void testFileAppendFailure() {
+  test("(append failure)", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await worker.initialize();
+    var nativeFile = File("file-${worker.id}");
+    if (nativeFile.existsSync()) nativeFile.deleteSync();
+    nativeFile.createSync();
+    final file = worker.files.open(nativeFile.path, mode: TransportFileMode.readOnly);
+    final appender = await file.appender();
+    final appends = Generators.requestsOrdered(8).map((bytes) => appender.append(bytes).then((_) => null, onError: (error) => error)).toList();
+    final errors = await Future.wait(appends);
+    expect(errors.every((error) => error is Exception), isTrue);
+    expect(appender.failure, isNotNull);
+    expect(appender.position, 0);
+    await expectLater(appender.append(Generators.request()), throwsA(isA<Exception>()));
+    await file.close();
+    if (nativeFile.existsSync()) nativeFile.deleteSync();
+    await transport.shutdown();
+  });
+}
+
+void testFileAppendSmallPool({required int count}) {
+  test("(append small pool) [count = $count]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker().copyWith(buffersCount: 4)));
+    await worker.initialize();
+    var nativeFile = File("file-${worker.id}");
+    if (nativeFile.existsSync()) nativeFile.deleteSync();
+    nativeFile.createSync();
+    final file = worker.files.open(nativeFile.path, create: true);
+    final appender = await file.appender(maxBatchSize: 4, preallocationSize: 1024 * 1024);
+    await Future.wait(Generators.requestsOrdered(count).map(appender.append));
+    expect(appender.position, Generators.requestsSumOrdered(count).length);
+    Validators.requestsSumOrdered(await file.load(), count);
+    await file.close();
+    if (nativeFile.existsSync()) nativeFile.deleteSync();
+    await transport.shutdown();
+  });
+}
+
+void testFileStaleCompletion() {
+  test("(stale completion)", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await worker.initialize();
+    var nativeFile = File("file-${worker.id}");
+    if (nativeFile.existsSync()) nativeFile.deleteSync();
+    final file = worker.files.open(nativeFile.path, create: true);
+    final index = worker.pointer.ref.slots_free;
+    transport_worker_slot_t slot() => worker.pointer.ref.slots[index];
+    final generation = slot().generation;
+    final stale = (generation << TRANSPORT_WORKER_SLOT_GENERATION_SHIFT) | (index << TRANSPORT_WORKER_SLOT_INDEX_SHIFT) | TRANSPORT_EVENT_SLOT | transportEventWrite | transportEventFile;
+    var done = Completer<void>();
+    file.writeSingle(Generators.request(), onDone: done.complete);
+    await done.future;
+    expect(slot().state, equals(transport_worker_slot_state.TRANSPORT_WORKER_SLOT_FREE));
+    expect(slot().generation, equals((generation + 1) & 0xffff));
+    done = Completer<void>();
+    file.writeSingle(Generators.request(), onDone: done.complete);
+    expect(worker.pointer.ref.slots_free, isNot(equals(index)));
+    expect(slot().state, equals(transport_worker_slot_state.TRANSPORT_WORKER_SLOT_ACTIVE));
+    expect(worker.bindings.transport_worker_remove_event(worker.pointer, stale), equals(0));
+    expect(worker.metrics.unroutedCompletions, equals(1));
+    expect(slot().state, equals(transport_worker_slot_state.TRANSPORT_WORKER_SLOT_ACTIVE));
+    await done.future;
+    expect(worker.metrics.unroutedCompletions, equals(1));
+    await file.close();
+    if (nativeFile.existsSync()) nativeFile.deleteSync();
+    await transport.shutdown();
+  });
+}
+
+void testFileLoadParallel({required int index, required int count, required int depth}) {
+  test("(load parallel) [index = $index, count = $count, depth = $depth]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await worker.initialize();
+    var nativeFile = File("file-${worker.id}");
+    if (nativeFile.existsSync()) nativeFile.deleteSync();
+    nativeFile.writeAsBytesSync(Generators.requestsSumOrdered(count), flush: true);
+    final file = worker.files.open(nativeFile.path);
+    Validators.requestsSumOrdered(await file.load(blocksCount: depth, parallel: true), count);
+    await file.close();
+    if (nativeFile.existsSync()) nativeFile.deleteSync();
+    await transport.shutdown();
+  });
+}
+
+void testFileMap({required int index, required int count}) {
+  test("(map) [index = $index, count = $count]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await worker.initialize();
+    var nativeFile = File("file-${worker.id}");
+    if (nativeFile.existsSync()) nativeFile.deleteSync();
+    nativeFile.writeAsBytesSync(Generators.requestsSumOrdered(count), flush: true);
+    final file = worker.files.map(nativeFile.path, advice: TransportFileAdvice.sequential);
+    await file.prefetch();
+    Validators.requestsSumOrdered(file.bytes, count);
+    final first = Generators.request();
+    Validators.request(file.view(length: first.length));
+    await file.close();
+    if (nativeFile.existsSync()) nativeFile.deleteSync();
+    await transport.shutdown();
+  });
+}
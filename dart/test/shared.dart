@@ -0,0 +1,83 @@
+import 'dart:io';
+import 'dart:typed_data';
+
+import 'package:iouring_transport/transport/defaults.dart';
+import 'package:iouring_transport/transport/transport.dart';
+import 'package:iouring_transport/transport/worker.dart';
+import 'package:test/test.dart';
+
+import 'generators.dart';
+import 'latch.dart';
+import 'validators.dart';
+
+void testSharedSingle({required int index, required int connections}) {
+  test("(single) [connections = $connections]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await worker.initialize();
+    final serverSocket = File(Directory.systemTemp.path + "/dart-iouring-shared_${worker.id}.sock");
+    if (serverSocket.existsSync()) serverSocket.deleteSync();
+    worker.shared.serve(
+      serverSocket.path,
+      (connection) => connection.stream().listen(
+        (event) {
+          Validators.request(event.takeBytes());
+          connection.writeSingle(Generators.response());
+        },
+      ),
+    );
+    final latch = Latch(connections);
+    for (var connectionIndex = 0; connectionIndex < connections; connectionIndex++) {
+      final connection = await worker.shared.connect(serverSocket.path);
+      connection.stream().listen((event) {
+        Validators.response(event.takeBytes());
+        latch.countDown();
+      });
+      connection.writeSingle(Generators.request());
+    }
+    await latch.done();
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
+
+void testSharedMany({required int index, required int capacity, required int count}) {
+  test("(many) [capacity = $capacity, count = $count]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await worker.initialize();
+    final serverSocket = File(Directory.systemTemp.path + "/dart-iouring-shared_${worker.id}.sock");
+    if (serverSocket.existsSync()) serverSocket.deleteSync();
+    final configuration = TransportDefaults.shared().copyWith(capacity: capacity);
+    worker.shared.serve(
+      serverSocket.path,
+      configuration: configuration,
+      (connection) {
+        final serverResults = BytesBuilder();
+        connection.stream().listen(
+          (event) {
+            serverResults.add(event.takeBytes());
+            if (serverResults.length == Generators.requestsSumOrdered(count).length) {
+              Validators.requestsSumOrdered(serverResults.takeBytes(), count);
+              connection.writeMany(Generators.responsesOrdered(count));
+            }
+          },
+        );
+      },
+    );
+    final latch = Latch(1);
+    final connection = await worker.shared.connect(serverSocket.path, configuration: configuration);
+    final clientResults = BytesBuilder();
+    connection.stream().listen(
+      (event) {
+        clientResults.add(event.takeBytes());
+        if (clientResults.length == Generators.responsesSumOrdered(count).length) {
+          Validators.responsesSumOrdered(clientResults.takeBytes(), count);
+          latch.countDown();
+        }
+      },
+    );
+    connection.writeMany(Generators.requestsOrdered(count));
+    await latch.done();
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
@@ -1,7 +1,13 @@
+import 'dart:async';
+import 'dart:convert';
 import 'dart:io' as io;
 import 'dart:typed_data';
 
+import 'package:iouring_transport/iouring_transport.dart';
+import 'package:iouring_transport/transport/constants.dart';
 import 'package:iouring_transport/transport/defaults.dart';
+import 'package:iouring_transport/transport/exception.dart';
+import 'package:iouring_transport/transport/frame.dart';
 import 'package:iouring_transport/transport/transport.dart';
 import 'package:iouring_transport/transport/worker.dart';
 import 'package:test/test.dart';
@@ -83,3 +89,546 @@ void testTcpMany({required int index, required int clientsPool, required int cou
     await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
   });
 }
+
+void testTcpTls({required int index}) {
+  test("(tls)", () async {
+    TransportTlsKeys keys(int seed) => TransportTlsKeys(
+          version: TransportTlsVersion.tls12,
+          cipher: TransportTlsCipher.aesGcm128,
+          key: Uint8List.fromList(List.generate(16, (index) => seed + index)),
+          iv: Uint8List.fromList(List.generate(8, (index) => seed * 2 + index)),
+          salt: Uint8List.fromList(List.generate(4, (index) => seed * 3 + index)),
+          sequence: Uint8List(8),
+        );
+    final clientKeys = keys(1);
+    final serverKeys = keys(64);
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await worker.initialize();
+    worker.servers.tcp(
+      io.InternetAddress("0.0.0.0"),
+      12345,
+      (connection) {
+        connection.enableTls(transmit: serverKeys, receive: clientKeys);
+        connection.stream().listen(
+          (event) {
+            Validators.request(event.takeBytes());
+            connection.writeSingle(Generators.response());
+          },
+        );
+      },
+    );
+    final clients = await worker.clients.tcp(io.InternetAddress("127.0.0.1"), 12345);
+    final latch = Latch(1);
+    final client = clients.select();
+    client.enableTls(transmit: clientKeys, receive: serverKeys);
+    client.writeSingle(Generators.request());
+    client.stream().listen((value) {
+      Validators.response(value.takeBytes());
+      latch.countDown();
+    });
+    await latch.done();
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
+
+void testTcpSelection({required int index, required int clientsPool, required int count, required TransportClientSelection selection}) {
+  test("(selection) [clients = $clientsPool, count = $count, selection = ${selection.name}]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await worker.initialize();
+    worker.servers.tcp(
+      io.InternetAddress("0.0.0.0"),
+      12345,
+      (connection) => connection.stream().listen(
+        (event) {
+          Validators.request(event.takeBytes());
+          connection.writeSingle(Generators.response());
+        },
+      ),
+    );
+    final clients = await worker.clients.tcp(
+      io.InternetAddress("127.0.0.1"),
+      12345,
+      configuration: TransportDefaults.tcpClient().copyWith(pool: clientsPool, selection: selection),
+    );
+    var responded = Completer<void>();
+    clients.forEach((client) => client.stream().listen((value) {
+          Validators.response(value.takeBytes());
+          responded.complete();
+        }));
+    for (var request = 0; request < count; request++) {
+      final client = clients.select();
+      expect(client.active, isTrue);
+      client.writeSingle(Generators.request());
+      await responded.future;
+      responded = Completer<void>();
+    }
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
+
+void testTcpSelectionStalled({required int count, required TransportClientSelection selection}) {
+  test("(selection stalled) [count = $count, selection = ${selection.name}]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await worker.initialize();
+    worker.servers.tcp(
+      io.InternetAddress("0.0.0.0"),
+      12345,
+      (connection) {},
+      configuration: TransportDefaults.tcpServer().copyWith(socketReceiveBufferSize: 4096),
+    );
+    final clients = await worker.clients.tcp(
+      io.InternetAddress("127.0.0.1"),
+      12345,
+      configuration: TransportDefaults.tcpClient().copyWith(pool: 2, selection: selection, socketSendBufferSize: 4096, socketNonblock: false),
+    );
+    final connections = <TransportClientConnection>[];
+    clients.forEach(connections.add);
+    final stalled = connections.first;
+    final healthy = connections.last;
+    final chunk = Uint8List(worker.buffers.bufferSize);
+    for (var index = 0; index < 256; index++) {
+      stalled.writeSingle(chunk, onError: (_) {});
+    }
+    await Future.delayed(Duration(milliseconds: 100));
+    expect(stalled.pending, greaterThan(healthy.pending));
+    for (var request = 0; request < count; request++) {
+      final selected = clients.select();
+      expect(identical(selected, healthy), isTrue);
+      final written = Completer<void>();
+      selected.writeSingle(Generators.request(), onDone: written.complete);
+      await written.future;
+    }
+    expect(stalled.pending, greaterThan(0));
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
+
+void testTcpMultiplexed({required int index, required int clientsPool, required int count}) {
+  test("(multiplexed) [clients = $clientsPool, count = $count]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await worker.initialize();
+    final encoder = Utf8Encoder();
+    final decoder = Utf8Decoder();
+    worker.servers.tcp(
+      io.InternetAddress("0.0.0.0"),
+      12345,
+      (connection) => connection.serveMultiplexed((request) {
+        final response = encoder.convert(decoder.convert(request).replaceFirst("request", "response"));
+        final delay = int.parse(decoder.convert(request).split("-").last) % 3;
+        return delay == 0 ? response : Future.delayed(Duration(milliseconds: delay), () => response);
+      }),
+    );
+    final clients = await worker.clients.tcp(io.InternetAddress("127.0.0.1"), 12345, configuration: TransportDefaults.tcpClient().copyWith(pool: clientsPool));
+    final multiplexed = clients.multiplex(deadline: Duration(seconds: 10));
+    final responses = await Future.wait(Generators.requestsOrdered(count).map(multiplexed.call));
+    for (var index = 0; index < count; index++) {
+      expect(responses[index], equals(Generators.responsesOrdered(count)[index]));
+    }
+    expect(multiplexed.inflight, 0);
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
+
+void testTcpMultiplexedLimits() {
+  test("(multiplexed limits)", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await worker.initialize();
+    worker.servers.tcp(
+      io.InternetAddress("0.0.0.0"),
+      12345,
+      (connection) => connection.serveMultiplexed((request) => request),
+    );
+    final clients = await worker.clients.tcp(io.InternetAddress("127.0.0.1"), 12345);
+    final multiplexed = clients.multiplex(deadline: Duration(seconds: 10));
+    final bufferSize = worker.buffers.bufferSize;
+    await expectLater(multiplexed.call(Uint8List(bufferSize)), throwsA(isA<TransportFrameLengthException>()));
+    final largest = Uint8List(bufferSize - transportFrameHeaderSize);
+    expect(await multiplexed.call(largest), equals(largest));
+    expect(multiplexed.inflight, 0);
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
+
+void testFrameDecoder() {
+  test("(frame decoder)", () {
+    final frames = <int, Uint8List>{};
+    final errors = <Exception>[];
+    final decoder = TransportFrameDecoder((id, body) => frames[id] = body, errors.add, maxFrameLength: 64);
+    final encoded = Uint8List.fromList([
+      ...encodeTransportFrame(1, Generators.request()),
+      ...encodeTransportFrame(2, Uint8List(0)),
+      ...encodeTransportFrame(3, Generators.response()),
+    ]);
+    for (var offset = 0; offset < encoded.length; offset++) {
+      decoder.add(Uint8List.sublistView(encoded, offset, offset + 1));
+    }
+    expect(frames.keys, equals([1, 2, 3]));
+    expect(frames[1], equals(Generators.request()));
+    expect(frames[2], isEmpty);
+    expect(frames[3], equals(Generators.response()));
+    expect(errors, isEmpty);
+    decoder.add(encodeTransportFrame(4, Uint8List(64)).sublist(0, transportFrameLengthSize));
+    expect(decoder.failed, isTrue);
+    expect(errors.single, isA<TransportFrameLengthException>());
+    decoder.add(encodeTransportFrame(5, Generators.request()));
+    expect(frames.keys, equals([1, 2, 3]));
+  });
+}
+
+void testTcpFastOpen({required int index, required int count}) {
+  test("(fast open) [count = $count]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await worker.initialize();
+    worker.servers.tcp(
+      io.InternetAddress("0.0.0.0"),
+      12345,
+      (connection) => connection.stream().listen(
+        (event) {
+          Validators.request(event.takeBytes());
+          connection.writeSingle(Generators.response());
+        },
+      ),
+      configuration: TransportDefaults.tcpServer().copyWith(tcpFastopen: true),
+    );
+    for (var request = 0; request < count; request++) {
+      final clients = await worker.clients.tcp(
+        io.InternetAddress("127.0.0.1"),
+        12345,
+        configuration: TransportDefaults.tcpClient().copyWith(tcpFastopenConnect: true),
+        data: Generators.request(),
+      );
+      final response = await clients.select().stream().first;
+      Validators.response(response.takeBytes());
+      await clients.close();
+    }
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
+
+void testTcpBackpressure({required int index, required int count}) {
+  test("(backpressure) [count = $count]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await worker.initialize();
+    final serverRequests = BytesBuilder();
+    final received = Completer<void>();
+    worker.servers.tcp(
+      io.InternetAddress("0.0.0.0"),
+      12345,
+      (connection) => connection.stream().listen(
+        (event) {
+          serverRequests.add(event.takeBytes());
+          if (serverRequests.length == Generators.requestsSumUnordered(count).length) received.complete();
+        },
+      ),
+    );
+    final clients = await worker.clients.tcp(
+      io.InternetAddress("127.0.0.1"),
+      12345,
+      configuration: TransportDefaults.tcpClient().copyWith(outboundHighWatermark: 4, outboundLowWatermark: 2),
+    );
+    final client = clients.select();
+    final latch = Latch(count);
+    var paused = false;
+    for (var request = 0; request < count; request++) {
+      client.writeSingle(Generators.request(), onDone: latch.countDown);
+      if (client.outbound > 4) throw TestFailure("outbound: ${client.outbound}");
+      if (!client.writable) paused = true;
+    }
+    expect(paused, isTrue);
+    await latch.done();
+    await client.whenWritable();
+    await received.future;
+    Validators.requestsSumUnordered(serverRequests.takeBytes(), count);
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
+
+void testTcpAdmission({required int index, required int clients}) {
+  test("(admission) [clients = $clients]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker().copyWith(buffersCount: 16)));
+    await worker.initialize();
+    final server = worker.servers.tcp(
+      io.InternetAddress("0.0.0.0"),
+      12345,
+      (connection) => connection.stream().listen(
+        (event) {
+          Validators.request(event.takeBytes());
+          connection.writeSingle(Generators.response());
+        },
+      ),
+      configuration: TransportDefaults.tcpServer().copyWith(admissionHighOccupancy: 0.5),
+    );
+    final responses = await Future.wait(List.generate(clients, (_) async {
+      final socket = await io.Socket.connect(io.InternetAddress("127.0.0.1"), 12345);
+      socket.add(Generators.request());
+      final response = await socket.first;
+      socket.destroy();
+      return response;
+    }));
+    responses.forEach((response) => Validators.response(Uint8List.fromList(response)));
+    expect(server.shedAccepts + server.shedReads, isPositive);
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
+
+void testTcpMetrics({required int index, required int count}) {
+  test("(metrics) [count = $count]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await worker.initialize();
+    final metrics = TransportWorkerMetrics.fromAddress(worker.metrics.address);
+    final initial = metrics.snapshot();
+    worker.servers.tcp(
+      io.InternetAddress("0.0.0.0"),
+      12345,
+      (connection) => connection.stream().listen(
+        (event) {
+          Validators.request(event.takeBytes());
+          connection.writeSingle(Generators.response());
+        },
+      ),
+    );
+    final clients = await worker.clients.tcp(io.InternetAddress("127.0.0.1"), 12345);
+    final client = clients.select();
+    for (var request = 0; request < count; request++) {
+      client.writeSingle(Generators.request());
+      Validators.response((await client.stream().first).takeBytes());
+    }
+    final exchanged = count * (Generators.request().length + Generators.response().length);
+    expect(metrics.sqesPrepared, greaterThan(initial["sqesPrepared"]!));
+    expect(metrics.submits, greaterThan(initial["submits"]!));
+    expect(metrics.cqesReaped, greaterThanOrEqualTo(count * 4));
+    expect(metrics.bytesRead - initial["bytesRead"]!, greaterThanOrEqualTo(exchanged));
+    expect(metrics.bytesWritten - initial["bytesWritten"]!, greaterThanOrEqualTo(exchanged));
+    expect(metrics.bytesReceived, equals(initial["bytesReceived"]));
+    expect(metrics.bytesSent, equals(initial["bytesSent"]));
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
+
+void testTcpLatencies({required int index, required int count}) {
+  test("(latencies) [count = $count]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await worker.initialize();
+    worker.servers.tcp(
+      io.InternetAddress("0.0.0.0"),
+      12345,
+      (connection) => connection.stream().listen(
+        (event) {
+          Validators.request(event.takeBytes());
+          connection.writeSingle(Generators.response());
+        },
+      ),
+    );
+    final clients = await worker.clients.tcp(io.InternetAddress("127.0.0.1"), 12345);
+    final client = clients.select();
+    for (var request = 0; request < count; request++) {
+      client.writeSingle(Generators.request());
+      Validators.response((await client.stream().first).takeBytes());
+    }
+    final latencies = worker.latencies(reset: true);
+    expect(latencies[TransportOperation.connect].count, equals(1));
+    expect(latencies[TransportOperation.accept].count, equals(1));
+    expect(latencies[TransportOperation.read].count, greaterThanOrEqualTo(count * 2));
+    expect(latencies[TransportOperation.write].count, greaterThanOrEqualTo(count * 2));
+    expect(latencies[TransportOperation.file].count, equals(0));
+    for (final entry in latencies.entries.where((entry) => entry.value.count > 0)) {
+      final histogram = entry.value;
+      expect(histogram.p50 <= histogram.p99, isTrue);
+      expect(histogram.p99 <= histogram.p999, isTrue);
+      expect(histogram.percentileNanos(1.0), equals(histogram.max));
+      expect(histogram.percentileNanos(0.0), greaterThanOrEqualTo(histogram.min));
+    }
+    expect(worker.latencies()[TransportOperation.write].count, equals(0));
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
+
+void testTcpTrace({required int index, required int traceCapacity, required int count}) {
+  test("(trace) [capacity = $traceCapacity, count = $count]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker().copyWith(traceCapacity: traceCapacity)));
+    await worker.initialize();
+    worker.servers.tcp(
+      io.InternetAddress("0.0.0.0"),
+      12345,
+      (connection) => connection.stream().listen(
+        (event) {
+          Validators.request(event.takeBytes());
+          connection.writeSingle(Generators.response());
+        },
+      ),
+    );
+    final clients = await worker.clients.tcp(io.InternetAddress("127.0.0.1"), 12345);
+    final client = clients.select();
+    for (var request = 0; request < count; request++) {
+      client.writeSingle(Generators.request());
+      Validators.response((await client.stream().first).takeBytes());
+    }
+    final dump = worker.dumpTrace();
+    final entries = decodeTransportTrace(dump);
+    expect(entries.length, equals(worker.trace().length));
+    expect(entries.length, equals(traceCapacity));
+    for (var entry = 1; entry < entries.length; entry++) {
+      expect(entries[entry].timestamp, greaterThanOrEqualTo(entries[entry - 1].timestamp));
+    }
+    expect(entries.where((entry) => entry.kind == TransportTraceKind.complete && entry.event & transportEventWrite != 0 && entry.result > 0), isNotEmpty);
+    expect(entries.where((entry) => entry.kind == TransportTraceKind.submit && entry.event & transportEventRead != 0), isNotEmpty);
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
+
+void testTcpMessagesQueue() {
+  test("(messages queue)", () async {
+    final transport = Transport();
+    final sender = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await sender.initialize();
+    final target = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await target.initialize();
+    for (var message = 0; message < transportMessagesQueueCapacity + 8; message++) {
+      sender.messenger.post(target.messenger.target, message);
+    }
+    while (target.messenger.queued + target.messenger.dropped < transportMessagesQueueCapacity + 8) {
+      await Future.delayed(Duration(milliseconds: 1));
+    }
+    expect(target.messenger.queued, equals(transportMessagesQueueCapacity));
+    expect(target.messenger.dropped, equals(8));
+    final received = await target.messenger.messages.take(transportMessagesQueueCapacity).map((message) => message.data).toList();
+    expect(received, equals(List.generate(transportMessagesQueueCapacity, (index) => index)));
+    expect(target.messenger.queued, equals(0));
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
+
+void testTcpHandOff({required int index, required int count}) {
+  test("(hand-off) [count = $count]", () async {
+    final transport = Transport();
+    final acceptor = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await acceptor.initialize();
+    final target = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await target.initialize();
+
+    final message = target.messenger.messages.first;
+    acceptor.messenger.post(target.messenger.target, 42, value: 7);
+    final received = await message;
+    expect(received.worker, equals(acceptor.id));
+    expect(received.data, equals(42));
+    expect(received.value, equals(7));
+
+    target.messenger.adopt(target.servers.tcp(
+      io.InternetAddress("0.0.0.0"),
+      12346,
+      (connection) => connection.stream().listen(
+        (event) {
+          Validators.request(event.takeBytes());
+          connection.writeSingle(Generators.response());
+        },
+      ),
+    ));
+    acceptor.servers.tcp(
+      io.InternetAddress("0.0.0.0"),
+      12345,
+      (connection) => unawaited(acceptor.messenger.handOff(target.messenger.target, connection)),
+    );
+    final clients = await acceptor.clients.tcp(io.InternetAddress("127.0.0.1"), 12345);
+    final client = clients.select();
+    final responses = client.stream();
+    final iterator = StreamIterator(responses);
+    for (var request = 0; request < count; request++) {
+      client.writeSingle(Generators.request());
+      expect(await iterator.moveNext(), isTrue);
+      Validators.response(iterator.current.takeBytes());
+    }
+    await iterator.cancel();
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
+
+void testTcpPool({required int index, required int clientsPool}) {
+  test("(pool) [clients = $clientsPool]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await worker.initialize();
+    worker.servers.tcp(
+      io.InternetAddress("0.0.0.0"),
+      12345,
+      (connection) => connection.stream().listen(
+        (event) {
+          Validators.request(event.takeBytes());
+          connection.writeSingle(Generators.response());
+        },
+      ),
+    );
+    final clients = await worker.clients.tcp(
+      io.InternetAddress("127.0.0.1"),
+      12345,
+      configuration: TransportDefaults.tcpClient().copyWith(
+        pool: clientsPool,
+        socketReceiveBufferSize: 64 * 1024,
+        socketSendBufferSize: 64 * 1024,
+        tcpKeepAliveIdle: 30,
+        tcpSynCount: 3,
+      ),
+    );
+    final latch = Latch(clientsPool);
+    clients.forEach((client) {
+      client.writeSingle(Generators.request());
+      client.stream().listen((value) {
+        Validators.response(value.takeBytes());
+        latch.countDown();
+      });
+    });
+    await latch.done();
+    await expectLater(
+      worker.clients.tcp(
+        io.InternetAddress("127.0.0.1"),
+        12345,
+        configuration: TransportDefaults.tcpClient().copyWith(pool: clientsPool, tcpMaxSegmentSize: 1),
+      ),
+      throwsA(isA<TransportInitializationException>()),
+    );
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
+
+void testTcpReuse({required int index, required int count}) {
+  test("(reuse) [count = $count]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await worker.initialize();
+    worker.servers.tcp(
+      io.InternetAddress("0.0.0.0"),
+      12345,
+      (connection) => connection.stream().listen(
+        (event) {
+          Validators.request(event.takeBytes());
+          connection.writeSingle(Generators.response());
+        },
+      ),
+    );
+    for (var request = 0; request < count; request++) {
+      final clients = await worker.clients.tcp(io.InternetAddress("127.0.0.1"), 12345, configuration: TransportDefaults.tcpClient().copyWith(pool: 4));
+      final latch = Latch(4);
+      clients.forEach((client) {
+        client.writeSingle(Generators.request());
+        client.stream().listen((value) {
+          Validators.response(value.takeBytes());
+          latch.countDown();
+        });
+      });
+      await latch.done();
+      await clients.close();
+    }
+    expect(worker.metrics.unroutedCompletions, equals(0));
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
@@ -1,3 +1,4 @@
+import 'package:iouring_transport/iouring_transport.dart';
 import 'package:iouring_transport/transport/defaults.dart';
 import 'package:iouring_transport/transport/transport.dart';
 import 'package:iouring_transport/transport/worker.dart';
@@ -6,6 +7,7 @@ import 'package:test/test.dart';
 import 'buffers.dart';
 import 'bulk.dart';
 import 'file.dart';
+import 'shared.dart';
 import 'shutdown.dart';
 import 'tcp.dart';
 import 'timeout.dart';
@@ -19,6 +21,7 @@ void main() {
   final tcp = true;
   final udp = true;
   final unixStream = true;
+  final shared = true;
   final file = true;
   final timeout = true;
   final buffers = true;
@@ -39,6 +42,28 @@ void main() {
       testTcpMany(index: index, clientsPool: 1, count: 64);
       testTcpMany(index: index, clientsPool: 128, count: 8);
       testTcpMany(index: index, clientsPool: 512, count: 4);
+      testTcpTls(index: index);
+      testTcpSelection(index: index, clientsPool: 8, count: 64, selection: TransportClientSelection.roundRobin);
+      testTcpSelection(index: index, clientsPool: 8, count: 64, selection: TransportClientSelection.leastOutstanding);
+      testTcpSelection(index: index, clientsPool: 8, count: 64, selection: TransportClientSelection.powerOfTwoChoices);
+      testTcpSelectionStalled(count: 16, selection: TransportClientSelection.leastOutstanding);
+      testTcpSelectionStalled(count: 16, selection: TransportClientSelection.powerOfTwoChoices);
+      testTcpMultiplexed(index: index, clientsPool: 1, count: 256);
+      testTcpMultiplexed(index: index, clientsPool: 8, count: 1024);
+      testTcpMultiplexedLimits();
+      testFrameDecoder();
+      testTcpFastOpen(index: index, count: 16);
+      testTcpBackpressure(index: index, count: 64);
+      testTcpAdmission(index: index, clients: 32);
+      testTcpMetrics(index: index, count: 16);
+      testTcpLatencies(index: index, count: 16);
+      testTcpTrace(index: index, traceCapacity: 16, count: 16);
+      testTcpTrace(index: index, traceCapacity: 4096, count: 1024);
+      testTcpHandOff(index: index, count: 16);
+      testTcpMessagesQueue();
+      testTcpPool(index: index, clientsPool: 1);
+      testTcpPool(index: index, clientsPool: 256);
+      testTcpReuse(index: index, count: 64);
     }
   });
   group("[unix stream]", timeout: Timeout(Duration(hours: 1)), skip: !unixStream, () {
@@ -50,6 +75,19 @@ void main() {
       testUnixStreamMany(index: index, clientsPool: 1, count: 64);
       testUnixStreamMany(index: index, clientsPool: 128, count: 8);
       testUnixStreamMany(index: index, clientsPool: 512, count: 4);
+      testUnixSeqpacketSingle(index: index, clientsPool: 1);
+      testUnixSeqpacketSingle(index: index, clientsPool: 128);
+      testUnixDatagramSingle(index: index, clients: 1);
+      testUnixDatagramSingle(index: index, clients: 128);
+    }
+  });
+  group("[shared]", timeout: Timeout(Duration(hours: 1)), skip: !shared, () {
+    final testsCount = 5;
+    for (var index = 0; index < testsCount; index++) {
+      testSharedSingle(index: index, connections: 1);
+      testSharedSingle(index: index, connections: 64);
+      testSharedMany(index: index, capacity: 1024 * 1024, count: 64);
+      testSharedMany(index: index, capacity: 4096, count: 1024);
     }
   });
   group("[udp]", timeout: Timeout(Duration(hours: 1)), skip: !udp, () {
@@ -61,15 +99,29 @@ void main() {
       testUdpMany(index: index, clients: 1, count: 64);
       testUdpMany(index: index, clients: 128, count: 8);
       testUdpMany(index: index, clients: 512, count: 4);
+      testUdpSegmented(index: index, count: 64);
+      testUdpSegmented(index: index, count: 256);
+      testUdpTimestamps(index: index);
     }
   });
   group("[file]", timeout: Timeout(Duration(hours: 1)), skip: !file, () {
     final testsCount = 5;
+    testFileAppendFailure();
+    testFileStaleCompletion();
     for (var index = 0; index < testsCount; index++) {
       testFileSingle(index: index);
       testFileLoad(index: index, count: 1);
       testFileLoad(index: index, count: 8);
       testFileLoad(index: index, count: 16);
+      testFileLoadParallel(index: index, count: 1, depth: 1);
+      testFileLoadParallel(index: index, count: 1024, depth: 8);
+      testFileLoadParallel(index: index, count: 8192, depth: 64);
+      testFileMap(index: index, count: 1);
+      testFileMap(index: index, count: 8192);
+      testFileAppend(index: index, count: 1);
+      testFileAppend(index: index, count: 128);
+      testFileAppend(index: index, count: 1024);
+      testFileAppendSmallPool(count: 64);
     }
   });
   group("[timeout]", timeout: Timeout(Duration(hours: 1)), skip: !timeout, () {
@@ -81,6 +133,8 @@ void main() {
     testUdpBuffers();
     testFileBuffers();
     testBuffersOverflow();
+    testBuffersGrowth();
+    testBuffersCallbacks();
   });
   group("[bulk]", timeout: Timeout(Duration(hours: 1)), skip: !bulk, () {
     testBulk();
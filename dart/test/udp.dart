@@ -68,3 +68,48 @@ void testUdpMany({required int index, required int clients, required int count})
     await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
   });
 }
+
+void testUdpSegmented({required int index, required int count}) {
+  test("(segmented) [count = $count]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await worker.initialize();
+    final latch = Latch(count);
+    worker.servers.udp(io.InternetAddress("0.0.0.0"), 12345, configuration: TransportDefaults.udpServer().copyWith(udpGro: true)).stream().listen(
+      (responder) {
+        for (var segment in responder.receivedSegments) {
+          Validators.request(segment);
+          latch.countDown();
+        }
+        responder.release();
+      },
+    );
+    final client = worker.clients.udp(io.InternetAddress("127.0.0.1"), (worker.id + 1) * 2000 + 1, io.InternetAddress("127.0.0.1"), 12345);
+    client.sendMany(Generators.requestsUnordered(count), segmented: true);
+    await latch.done();
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
+
+void testUdpTimestamps({required int index}) {
+  test("(timestamps)", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await worker.initialize();
+    final latch = Latch(1);
+    worker.servers.udp(io.InternetAddress("0.0.0.0"), 12345, configuration: TransportDefaults.udpServer().copyWith(socketTimestamping: true)).stream().listen(
+      (responder) {
+        Validators.request(responder.receivedBytes);
+        expect(responder.receivedKernelTimestamp, isPositive);
+        expect(responder.receivedReapTimestamp, greaterThanOrEqualTo(responder.receivedKernelTimestamp));
+        expect(responder.receivedDeliveryTimestamp, greaterThanOrEqualTo(responder.receivedReapTimestamp ~/ 1000 * 1000));
+        responder.release();
+        latch.countDown();
+      },
+    );
+    final client = worker.clients.udp(io.InternetAddress("127.0.0.1"), (worker.id + 1) * 2000 + 1, io.InternetAddress("127.0.0.1"), 12345);
+    client.sendSingle(Generators.request());
+    await latch.done();
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
@@ -81,3 +81,62 @@ void testUnixStreamMany({required int index, required int clientsPool, required
     await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
   });
 }
+
+void testUnixSeqpacketSingle({required int index, required int clientsPool}) {
+  test("(seqpacket) [clients = $clientsPool]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await worker.initialize();
+    final serverSocket = File(Directory.systemTemp.path + "/dart-iouring-seqpacket_${worker.id}.sock");
+    if (serverSocket.existsSync()) serverSocket.deleteSync();
+    worker.servers.unixSeqpacket(
+      serverSocket.path,
+      (connection) => connection.stream().listen(
+        (event) {
+          Validators.request(event.takeBytes());
+          connection.writeSingle(Generators.response());
+        },
+      ),
+    );
+    final latch = Latch(clientsPool);
+    final clients = await worker.clients.unixSeqpacket(serverSocket.path, configuration: TransportDefaults.unixStreamClient().copyWith(pool: clientsPool));
+    clients.forEach((client) {
+      client.writeSingle(Generators.request());
+      client.stream().listen((event) {
+        Validators.response(event.takeBytes());
+        latch.countDown();
+      });
+    });
+    await latch.done();
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
+
+void testUnixDatagramSingle({required int index, required int clients}) {
+  test("(datagram) [clients = $clients]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await worker.initialize();
+    final serverSocket = File(Directory.systemTemp.path + "/dart-iouring-datagram_${worker.id}.sock");
+    if (serverSocket.existsSync()) serverSocket.deleteSync();
+    worker.servers.unixDatagram(serverSocket.path).stream().listen(
+      (event) {
+        Validators.request(event.takeBytes());
+        event.respondSingle(Generators.response());
+      },
+    );
+    final latch = Latch(clients);
+    for (var clientIndex = 0; clientIndex < clients; clientIndex++) {
+      final clientSocket = File(Directory.systemTemp.path + "/dart-iouring-datagram_${worker.id}_$clientIndex.sock");
+      if (clientSocket.existsSync()) clientSocket.deleteSync();
+      final client = worker.clients.unixDatagram(clientSocket.path, serverSocket.path);
+      client.stream().listen((event) {
+        Validators.response(event.takeBytes());
+        latch.countDown();
+      });
+      client.sendSingle(Generators.request());
+    }
+    await latch.done();
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
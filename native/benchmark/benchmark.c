@@ -0,0 +1,767 @@
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+#include "transport.h"
+#include "transport_client.h"
+#include "transport_constants.h"
+#include "transport_histogram.h"
+#include "transport_server.h"
+#include "transport_worker.h"
+
+#define BENCHMARK_EPOLL_EVENTS 256
+#define BENCHMARK_EPOLL_LISTENER ((uint64_t)1 << 32)
+#define BENCHMARK_EPOLL_SERVER ((uint64_t)2 << 32)
+#define BENCHMARK_EPOLL_CLIENT ((uint64_t)3 << 32)
+
+typedef enum benchmark_engine
+{
+    BENCHMARK_ENGINE_IO_URING = 1 << 0,
+    BENCHMARK_ENGINE_EPOLL = 1 << 1,
+} benchmark_engine_t;
+
+typedef enum benchmark_protocol
+{
+    BENCHMARK_PROTOCOL_TCP = 0,
+    BENCHMARK_PROTOCOL_UDP,
+    BENCHMARK_PROTOCOL_UNIX,
+} benchmark_protocol_t;
+
+typedef struct benchmark_options
+{
+    int engines;
+    benchmark_protocol_t protocol;
+    uint32_t connections;
+    uint32_t message_size;
+    uint32_t buffer_size;
+    uint32_t buffers_count;
+    uint32_t ring_size;
+    unsigned int ring_flags;
+    uint32_t duration_seconds;
+    uint32_t warmup_seconds;
+    const char* ip;
+    int32_t port;
+    const char* path;
+} benchmark_options_t;
+
+typedef struct benchmark_connection
+{
+    int fd;
+    int32_t buffer_id;
+    uint32_t received;
+    uint64_t started;
+    transport_client_t client;
+} benchmark_connection_t;
+
+typedef struct benchmark_state
+{
+    benchmark_options_t* options;
+    transport_histogram_t latency;
+    uint64_t messages;
+    bool measuring;
+    benchmark_connection_t* connections;
+    benchmark_connection_t** connections_by_fd;
+    int descriptors_capacity;
+    uint8_t* scratch;
+} benchmark_state_t;
+
+static const char* benchmark_protocol_names[] = {"tcp", "udp", "unix"};
+
+static inline uint64_t benchmark_now()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+static void benchmark_fail(const char* message, int error)
+{
+    fprintf(stderr, "[benchmark] %s: %s\n", message, strerror(error < 0 ? -error : error));
+    exit(EXIT_FAILURE);
+}
+
+static void benchmark_usage(const char* program)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  --engine io_uring|epoll|both   engines to run (default both)\n"
+            "  --protocol tcp|udp|unix        loopback protocol (default tcp)\n"
+            "  --connections N                concurrent ping-pong connections (default 64)\n"
+            "  --message-size N               payload bytes per message (default 64)\n"
+            "  --buffer-size N                io_uring buffer size (default 4096)\n"
+            "  --buffers N                    io_uring buffers count, at most 16384 (default 2 * connections + 16)\n"
+            "  --ring-size N                  io_uring ring size (default 16384)\n"
+            "  --ring-flags FLAGS             numeric value or comma separated sqpoll,single_issuer,coop_taskrun,defer_taskrun,submit_all\n"
+            "  --duration N                   measured seconds (default 10)\n"
+            "  --warmup N                     warmup seconds (default 1)\n"
+            "  --ip ADDRESS                   loopback address (default 127.0.0.1)\n"
+            "  --port N                       port (default 12345)\n"
+            "  --path PATH                    unix socket path (default /tmp/transport_benchmark.sock)\n",
+            program);
+}
+
+static unsigned int benchmark_parse_ring_flags(char* value)
+{
+    char* end;
+    unsigned long numeric = strtoul(value, &end, 0);
+    if (*end == '\0')
+    {
+        return (unsigned int)numeric;
+    }
+    unsigned int flags = 0;
+    for (char* token = strtok(value, ","); token != NULL; token = strtok(NULL, ","))
+    {
+        if (!strcmp(token, "sqpoll")) flags |= IORING_SETUP_SQPOLL;
+        else if (!strcmp(token, "single_issuer")) flags |= IORING_SETUP_SINGLE_ISSUER;
+        else if (!strcmp(token, "coop_taskrun")) flags |= IORING_SETUP_COOP_TASKRUN;
+        else if (!strcmp(token, "defer_taskrun")) flags |= IORING_SETUP_DEFER_TASKRUN | IORING_SETUP_SINGLE_ISSUER;
+        else if (!strcmp(token, "submit_all")) flags |= IORING_SETUP_SUBMIT_ALL;
+        else benchmark_fail("unknown ring flag", EINVAL);
+    }
+    return flags;
+}
+
+static void benchmark_parse_options(int argc, char** argv, benchmark_options_t* options)
+{
+    static struct option long_options[] = {
+        {"engine", required_argument, 0, 'e'},
+        {"protocol", required_argument, 0, 'p'},
+        {"connections", required_argument, 0, 'c'},
+        {"message-size", required_argument, 0, 'm'},
+        {"buffer-size", required_argument, 0, 'b'},
+        {"buffers", required_argument, 0, 'n'},
+        {"ring-size", required_argument, 0, 'r'},
+        {"ring-flags", required_argument, 0, 'f'},
+        {"duration", required_argument, 0, 'd'},
+        {"warmup", required_argument, 0, 'w'},
+        {"ip", required_argument, 0, 'i'},
+        {"port", required_argument, 0, 'P'},
+        {"path", required_argument, 0, 'u'},
+        {"help", no_argument, 0, 'h'},
+        {0, 0, 0, 0},
+    };
+    *options = (benchmark_options_t){
+        .engines = BENCHMARK_ENGINE_IO_URING | BENCHMARK_ENGINE_EPOLL,
+        .protocol = BENCHMARK_PROTOCOL_TCP,
+        .connections = 64,
+        .message_size = 64,
+        .buffer_size = 4096,
+        .buffers_count = 0,
+        .ring_size = 16384,
+        .ring_flags = 0,
+        .duration_seconds = 10,
+        .warmup_seconds = 1,
+        .ip = "127.0.0.1",
+        .port = 12345,
+        .path = "/tmp/transport_benchmark.sock",
+    };
+    int option;
+    while ((option = getopt_long(argc, argv, "", long_options, NULL)) != -1)
+    {
+        switch (option)
+        {
+            case 'e':
+                if (!strcmp(optarg, "io_uring")) options->engines = BENCHMARK_ENGINE_IO_URING;
+                else if (!strcmp(optarg, "epoll")) options->engines = BENCHMARK_ENGINE_EPOLL;
+                else if (!strcmp(optarg, "both")) options->engines = BENCHMARK_ENGINE_IO_URING | BENCHMARK_ENGINE_EPOLL;
+                else benchmark_fail("unknown engine", EINVAL);
+                break;
+            case 'p':
+                if (!strcmp(optarg, "tcp")) options->protocol = BENCHMARK_PROTOCOL_TCP;
+                else if (!strcmp(optarg, "udp")) options->protocol = BENCHMARK_PROTOCOL_UDP;
+                else if (!strcmp(optarg, "unix")) options->protocol = BENCHMARK_PROTOCOL_UNIX;
+                else benchmark_fail("unknown protocol", EINVAL);
+                break;
+            case 'c':
+                options->connections = strtoul(optarg, NULL, 0);
+                break;
+            case 'm':
+                options->message_size = strtoul(optarg, NULL, 0);
+                break;
+            case 'b':
+                options->buffer_size = strtoul(optarg, NULL, 0);
+                break;
+            case 'n':
+                options->buffers_count = strtoul(optarg, NULL, 0);
+                break;
+            case 'r':
+                options->ring_size = strtoul(optarg, NULL, 0);
+                break;
+            case 'f':
+                options->ring_flags = benchmark_parse_ring_flags(optarg);
+                break;
+            case 'd':
+                options->duration_seconds = strtoul(optarg, NULL, 0);
+                break;
+            case 'w':
+                options->warmup_seconds = strtoul(optarg, NULL, 0);
+                break;
+            case 'i':
+                options->ip = optarg;
+                break;
+            case 'P':
+                options->port = strtol(optarg, NULL, 0);
+                break;
+            case 'u':
+                options->path = optarg;
+                break;
+            default:
+                benchmark_usage(argv[0]);
+                exit(option == 'h' ? EXIT_SUCCESS : EXIT_FAILURE);
+        }
+    }
+    if (options->buffers_count == 0)
+    {
+        options->buffers_count = options->connections * 2 + 16;
+    }
+    if (options->connections == 0 || options->message_size == 0)
+    {
+        benchmark_fail("connections and message size must be positive", EINVAL);
+    }
+    if (options->message_size > options->buffer_size)
+    {
+        benchmark_fail("message size must not exceed buffer size", EINVAL);
+    }
+    if (options->buffers_count > TRANSPORT_WORKER_BUFFERS_LIMIT)
+    {
+        benchmark_fail("buffers count must not exceed 16384, the kernel limit for registered buffers (reduce --buffers or --connections)", EINVAL);
+    }
+    if (options->buffers_count < options->connections * 2)
+    {
+        benchmark_fail("buffers count must be at least 2 * connections", EINVAL);
+    }
+}
+
+static void benchmark_state_create(benchmark_state_t* state, benchmark_options_t* options)
+{
+    memset(state, 0, sizeof(benchmark_state_t));
+    state->options = options;
+    transport_histogram_reset(&state->latency);
+    state->descriptors_capacity = options->connections * 4 + 1024;
+    state->connections = calloc(options->connections, sizeof(benchmark_connection_t));
+    state->connections_by_fd = calloc(state->descriptors_capacity, sizeof(benchmark_connection_t*));
+    state->scratch = calloc(1, options->buffer_size);
+    if (!state->connections || !state->connections_by_fd || !state->scratch)
+    {
+        benchmark_fail("state", ENOMEM);
+    }
+}
+
+static void benchmark_state_destroy(benchmark_state_t* state)
+{
+    free(state->connections);
+    free(state->connections_by_fd);
+    free(state->scratch);
+}
+
+static void benchmark_register(benchmark_state_t* state, benchmark_connection_t* connection)
+{
+    if (connection->fd >= state->descriptors_capacity)
+    {
+        benchmark_fail("descriptor is out of the connection table", EMFILE);
+    }
+    state->connections_by_fd[connection->fd] = connection;
+}
+
+static inline void benchmark_complete(benchmark_state_t* state, benchmark_connection_t* connection)
+{
+    if (state->measuring)
+    {
+        transport_histogram_record(&state->latency, benchmark_now() - connection->started);
+        state->messages++;
+    }
+}
+
+static void benchmark_report(benchmark_state_t* state, const char* engine, double seconds)
+{
+    benchmark_options_t* options = state->options;
+    transport_histogram_t* latency = &state->latency;
+    double rate = state->messages / seconds;
+    printf("engine=%s protocol=%s connections=%u message_size=%u ring_flags=0x%x duration=%us\n",
+           engine,
+           benchmark_protocol_names[options->protocol],
+           options->connections,
+           options->message_size,
+           options->ring_flags,
+           options->duration_seconds);
+    printf("  throughput: %.0f msg/s, %.2f MiB/s\n", rate, rate * options->message_size / (1024.0 * 1024.0));
+    printf("  latency (us): min=%.2f p50=%.2f p90=%.2f p99=%.2f p999=%.2f max=%.2f mean=%.2f\n",
+           latency->count ? latency->min / 1000.0 : 0.0,
+           transport_histogram_percentile(latency, 0.5) / 1000.0,
+           transport_histogram_percentile(latency, 0.9) / 1000.0,
+           transport_histogram_percentile(latency, 0.99) / 1000.0,
+           transport_histogram_percentile(latency, 0.999) / 1000.0,
+           latency->max / 1000.0,
+           latency->count ? (double)latency->sum / latency->count / 1000.0 : 0.0);
+}
+
+static void benchmark_io_uring_send(transport_worker_t* worker, benchmark_state_t* state, benchmark_connection_t* connection)
+{
+    connection->received = 0;
+    connection->started = benchmark_now();
+    worker->buffers[connection->buffer_id].iov_len = state->options->message_size;
+    if (state->options->protocol == BENCHMARK_PROTOCOL_UDP)
+    {
+        transport_worker_send_message(worker,
+                                      connection->fd,
+                                      connection->buffer_id,
+                                      transport_client_get_destination_address(&connection->client),
+                                      INET,
+                                      0,
+                                      TRANSPORT_TIMEOUT_INFINITY,
+                                      TRANSPORT_EVENT_SEND_MESSAGE | TRANSPORT_EVENT_CLIENT,
+                                      0);
+        return;
+    }
+    transport_worker_write(worker, connection->fd, connection->buffer_id, 0, TRANSPORT_TIMEOUT_INFINITY, TRANSPORT_EVENT_WRITE | TRANSPORT_EVENT_CLIENT, 0);
+}
+
+static void benchmark_io_uring_receive(transport_worker_t* worker, benchmark_state_t* state, int fd, uint16_t buffer_id, uint16_t event)
+{
+    worker->buffers[buffer_id].iov_len = state->options->buffer_size;
+    if (state->options->protocol == BENCHMARK_PROTOCOL_UDP)
+    {
+        transport_worker_receive_message(worker, fd, buffer_id, INET, 0, TRANSPORT_TIMEOUT_INFINITY, TRANSPORT_EVENT_RECEIVE_MESSAGE | event, 0);
+        return;
+    }
+    transport_worker_read(worker, fd, buffer_id, 0, TRANSPORT_TIMEOUT_INFINITY, TRANSPORT_EVENT_READ | event, 0);
+}
+
+static void benchmark_io_uring_handle_client(transport_worker_t* worker, benchmark_state_t* state, int fd, int result, uint16_t event)
+{
+    benchmark_connection_t* connection = state->connections_by_fd[fd];
+    if (event & TRANSPORT_EVENT_CONNECT)
+    {
+        if (result < 0) benchmark_fail("connect", result);
+        benchmark_io_uring_send(worker, state, connection);
+        return;
+    }
+    if (event & (TRANSPORT_EVENT_WRITE | TRANSPORT_EVENT_SEND_MESSAGE))
+    {
+        if (result < 0) benchmark_fail("client send", result);
+        benchmark_io_uring_receive(worker, state, fd, connection->buffer_id, TRANSPORT_EVENT_CLIENT);
+        return;
+    }
+    if (result <= 0) benchmark_fail("client receive", result == 0 ? ECONNRESET : result);
+    connection->received += result;
+    if (connection->received < state->options->message_size)
+    {
+        benchmark_io_uring_receive(worker, state, fd, connection->buffer_id, TRANSPORT_EVENT_CLIENT);
+        return;
+    }
+    benchmark_complete(state, connection);
+    benchmark_io_uring_send(worker, state, connection);
+}
+
+static void benchmark_io_uring_handle_server(transport_worker_t* worker, benchmark_state_t* state, transport_server_t* server, int fd, uint16_t buffer_id, int result, uint16_t event)
+{
+    if (event & TRANSPORT_EVENT_ACCEPT)
+    {
+        if (result < 0) benchmark_fail("accept", result);
+        int32_t accepted_buffer_id = transport_worker_get_buffer(worker);
+        if (accepted_buffer_id == TRANSPORT_BUFFER_USED) benchmark_fail("accept buffer", ENOBUFS);
+        benchmark_io_uring_receive(worker, state, result, accepted_buffer_id, TRANSPORT_EVENT_SERVER);
+        transport_worker_accept(worker, server);
+        return;
+    }
+    if (event & TRANSPORT_EVENT_RECEIVE_MESSAGE)
+    {
+        if (result < 0) benchmark_fail("server receive", result);
+        struct sockaddr_in address = *(struct sockaddr_in*)transport_worker_get_datagram_address(worker, INET, buffer_id);
+        worker->buffers[buffer_id].iov_len = result;
+        transport_worker_send_message(worker,
+                                      fd,
+                                      buffer_id,
+                                      (struct sockaddr*)&address,
+                                      INET,
+                                      0,
+                                      TRANSPORT_TIMEOUT_INFINITY,
+                                      TRANSPORT_EVENT_SEND_MESSAGE | TRANSPORT_EVENT_SERVER,
+                                      0);
+        return;
+    }
+    if (event & TRANSPORT_EVENT_READ)
+    {
+        if (result <= 0)
+        {
+            transport_worker_release_buffer(worker, buffer_id);
+            transport_close_descriptor(fd);
+            return;
+        }
+        worker->buffers[buffer_id].iov_len = result;
+        transport_worker_write(worker, fd, buffer_id, 0, TRANSPORT_TIMEOUT_INFINITY, TRANSPORT_EVENT_WRITE | TRANSPORT_EVENT_SERVER, 0);
+        return;
+    }
+    if (result < 0 && state->options->protocol != BENCHMARK_PROTOCOL_UDP)
+    {
+        transport_worker_release_buffer(worker, buffer_id);
+        transport_close_descriptor(fd);
+        return;
+    }
+    benchmark_io_uring_receive(worker, state, fd, buffer_id, TRANSPORT_EVENT_SERVER);
+}
+
+static void benchmark_io_uring(benchmark_options_t* options)
+{
+    benchmark_state_t state;
+    benchmark_state_create(&state, options);
+
+    transport_worker_configuration_t worker_configuration = {
+        .buffers_count = options->buffers_count,
+        .buffer_size = options->buffer_size,
+        .ring_size = options->ring_size,
+        .ring_flags = options->ring_flags,
+        .timeout_checker_period_millis = 0,
+        .base_delay_micros = 0,
+        .delay_randomization_factor = 0,
+        .max_delay_micros = 0,
+        .cqe_wait_timeout_millis = 1,
+        .cqe_wait_count = 1,
+        .cqe_peek_count = options->ring_size,
+        .trace = false,
+        .trace_capacity = 0,
+    };
+    transport_worker_t* worker = calloc(1, sizeof(transport_worker_t));
+    if (!worker) benchmark_fail("worker", ENOMEM);
+    int result = transport_worker_initialize(worker, &worker_configuration, 0);
+    if (result < 0) benchmark_fail("worker", result);
+
+    transport_server_configuration_t server_configuration = {
+        .socket_max_connections = options->connections * 2,
+        .socket_configuration_flags = TRANSPORT_SOCKET_OPTION_SOCKET_REUSEADDR,
+    };
+    transport_client_configuration_t client_configuration = {0};
+    if (options->protocol == BENCHMARK_PROTOCOL_TCP)
+    {
+        server_configuration.socket_configuration_flags |= TRANSPORT_SOCKET_OPTION_TCP_NODELAY;
+        client_configuration.socket_configuration_flags |= TRANSPORT_SOCKET_OPTION_TCP_NODELAY;
+    }
+
+    transport_server_t server;
+    switch (options->protocol)
+    {
+        case BENCHMARK_PROTOCOL_TCP:
+            result = transport_server_initialize_tcp(&server, &server_configuration, options->ip, options->port);
+            break;
+        case BENCHMARK_PROTOCOL_UDP:
+            result = transport_server_initialize_udp(&server, &server_configuration, options->ip, options->port);
+            break;
+        case BENCHMARK_PROTOCOL_UNIX:
+            unlink(options->path);
+            result = transport_server_initialize_unix_stream(&server, &server_configuration, options->path);
+            break;
+    }
+    if (result < 0) benchmark_fail("server", errno);
+
+    if (options->protocol == BENCHMARK_PROTOCOL_UDP)
+    {
+        for (uint32_t index = 0; index < options->connections; index++)
+        {
+            int32_t buffer_id = transport_worker_get_buffer(worker);
+            benchmark_io_uring_receive(worker, &state, server.fd, buffer_id, TRANSPORT_EVENT_SERVER);
+        }
+    }
+    else
+    {
+        transport_worker_accept(worker, &server);
+    }
+
+    for (uint32_t index = 0; index < options->connections; index++)
+    {
+        benchmark_connection_t* connection = &state.connections[index];
+        switch (options->protocol)
+        {
+            case BENCHMARK_PROTOCOL_TCP:
+                result = transport_client_initialize_tcp(&connection->client, &client_configuration, options->ip, options->port);
+                break;
+            case BENCHMARK_PROTOCOL_UDP:
+                result = transport_client_initialize_udp(&connection->client, &client_configuration, options->ip, options->port, options->ip, 0);
+                break;
+            case BENCHMARK_PROTOCOL_UNIX:
+                result = transport_client_initialize_unix_stream(&connection->client, &client_configuration, options->path);
+                break;
+        }
+        if (result < 0) benchmark_fail("client", errno);
+        connection->fd = connection->client.fd;
+        connection->buffer_id = transport_worker_get_buffer(worker);
+        memset(worker->buffers[connection->buffer_id].iov_base, 'x', options->message_size);
+        benchmark_register(&state, connection);
+        if (options->protocol == BENCHMARK_PROTOCOL_UDP)
+        {
+            benchmark_io_uring_send(worker, &state, connection);
+            continue;
+        }
+        transport_worker_connect(worker, &connection->client, TRANSPORT_TIMEOUT_INFINITY);
+    }
+
+    uint64_t started = benchmark_now();
+    uint64_t measure_from = started + options->warmup_seconds * 1000000000ULL;
+    uint64_t measure_until = measure_from + options->duration_seconds * 1000000000ULL;
+    transport_worker_metrics_t metrics_from = *worker->metrics;
+    for (uint64_t now = started; now < measure_until; now = benchmark_now())
+    {
+        if (!state.measuring && now >= measure_from)
+        {
+            state.measuring = true;
+            metrics_from = *worker->metrics;
+        }
+        int count = transport_worker_peek(worker);
+        for (int index = 0; index < count; index++)
+        {
+            struct io_uring_cqe* cqe = worker->cqes[index];
+            uint64_t data = transport_worker_remove_event(worker, cqe->user_data);
+            if (!data)
+            {
+                continue;
+            }
+            int fd = (int)((data >> 32) & 0xffffffff);
+            uint16_t buffer_id = (uint16_t)((data >> 16) & 0xffff);
+            uint16_t event = (uint16_t)(data & 0xffff);
+            if (event & TRANSPORT_EVENT_CLIENT)
+            {
+                benchmark_io_uring_handle_client(worker, &state, fd, cqe->res, event);
+                continue;
+            }
+            benchmark_io_uring_handle_server(worker, &state, &server, fd, buffer_id, cqe->res, event);
+        }
+        transport_cqe_advance(worker->ring, count);
+    }
+
+    benchmark_report(&state, "io_uring", options->duration_seconds);
+    transport_worker_metrics_t* metrics = worker->metrics;
+    printf("  worker: sqes=%lu submits=%lu cqes=%lu empty_peeks=%lu sq_full_waits=%lu\n",
+           metrics->sqes_prepared - metrics_from.sqes_prepared,
+           metrics->submits - metrics_from.submits,
+           metrics->cqes_reaped - metrics_from.cqes_reaped,
+           metrics->empty_peeks - metrics_from.empty_peeks,
+           metrics->sq_full_waits - metrics_from.sq_full_waits);
+
+    for (uint32_t index = 0; index < options->connections; index++)
+    {
+        transport_client_destroy(&state.connections[index].client);
+    }
+    transport_server_destroy(&server);
+    transport_worker_destroy(worker);
+    benchmark_state_destroy(&state);
+}
+
+static int benchmark_epoll_socket(benchmark_options_t* options, int type)
+{
+    int fd = socket(options->protocol == BENCHMARK_PROTOCOL_UNIX ? AF_UNIX : AF_INET, type, 0);
+    if (fd < 0) benchmark_fail("socket", errno);
+    int enable = 1;
+    if (options->protocol == BENCHMARK_PROTOCOL_TCP && type == SOCK_STREAM)
+    {
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+    }
+    return fd;
+}
+
+static socklen_t benchmark_epoll_address(benchmark_options_t* options, struct sockaddr_storage* address)
+{
+    memset(address, 0, sizeof(struct sockaddr_storage));
+    if (options->protocol == BENCHMARK_PROTOCOL_UNIX)
+    {
+        struct sockaddr_un* unix_address = (struct sockaddr_un*)address;
+        unix_address->sun_family = AF_UNIX;
+        strncpy(unix_address->sun_path, options->path, sizeof(unix_address->sun_path) - 1);
+        return sizeof(struct sockaddr_un);
+    }
+    struct sockaddr_in* inet_address = (struct sockaddr_in*)address;
+    inet_address->sin_family = AF_INET;
+    inet_address->sin_addr.s_addr = inet_addr(options->ip);
+    inet_address->sin_port = htons(options->port);
+    return sizeof(struct sockaddr_in);
+}
+
+static void benchmark_epoll_watch(int epoll, int fd, uint64_t role)
+{
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    struct epoll_event event = {
+        .events = EPOLLIN,
+        .data.u64 = role | (uint32_t)fd,
+    };
+    if (epoll_ctl(epoll, EPOLL_CTL_ADD, fd, &event) < 0) benchmark_fail("epoll_ctl", errno);
+}
+
+static void benchmark_epoll_write(int fd, uint8_t* buffer, size_t length)
+{
+    size_t written = 0;
+    while (written < length)
+    {
+        ssize_t result = write(fd, buffer + written, length - written);
+        if (result < 0)
+        {
+            if (errno == EAGAIN || errno == EINTR) continue;
+            benchmark_fail("write", errno);
+        }
+        written += result;
+    }
+}
+
+static inline void benchmark_epoll_send(benchmark_state_t* state, benchmark_connection_t* connection)
+{
+    connection->received = 0;
+    connection->started = benchmark_now();
+    memset(state->scratch, 'x', state->options->message_size);
+    benchmark_epoll_write(connection->fd, state->scratch, state->options->message_size);
+}
+
+static void benchmark_epoll_handle_server(benchmark_state_t* state, int fd)
+{
+    for (;;)
+    {
+        if (state->options->protocol == BENCHMARK_PROTOCOL_UDP)
+        {
+            struct sockaddr_in address;
+            socklen_t address_length = sizeof(address);
+            ssize_t result = recvfrom(fd, state->scratch, state->options->buffer_size, 0, (struct sockaddr*)&address, &address_length);
+            if (result < 0)
+            {
+                if (errno == EAGAIN) return;
+                benchmark_fail("recvfrom", errno);
+            }
+            sendto(fd, state->scratch, result, 0, (struct sockaddr*)&address, address_length);
+            continue;
+        }
+        ssize_t result = read(fd, state->scratch, state->options->buffer_size);
+        if (result < 0)
+        {
+            if (errno == EAGAIN) return;
+            benchmark_fail("server read", errno);
+        }
+        if (result == 0)
+        {
+            close(fd);
+            return;
+        }
+        benchmark_epoll_write(fd, state->scratch, result);
+    }
+}
+
+static void benchmark_epoll_handle_client(benchmark_state_t* state, int fd)
+{
+    benchmark_connection_t* connection = state->connections_by_fd[fd];
+    for (;;)
+    {
+        ssize_t result = read(fd, state->scratch, state->options->buffer_size);
+        if (result < 0)
+        {
+            if (errno == EAGAIN) return;
+            benchmark_fail("client read", errno);
+        }
+        if (result == 0) benchmark_fail("client read", ECONNRESET);
+        connection->received += result;
+        if (connection->received >= state->options->message_size)
+        {
+            benchmark_complete(state, connection);
+            benchmark_epoll_send(state, connection);
+        }
+    }
+}
+
+static void benchmark_epoll(benchmark_options_t* options)
+{
+    benchmark_state_t state;
+    benchmark_state_create(&state, options);
+    int epoll = epoll_create1(0);
+    if (epoll < 0) benchmark_fail("epoll_create1", errno);
+
+    int type = options->protocol == BENCHMARK_PROTOCOL_UDP ? SOCK_DGRAM : SOCK_STREAM;
+    struct sockaddr_storage address;
+    socklen_t address_length = benchmark_epoll_address(options, &address);
+    int listener = benchmark_epoll_socket(options, type);
+    int enable = 1;
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+    if (options->protocol == BENCHMARK_PROTOCOL_UNIX) unlink(options->path);
+    if (bind(listener, (struct sockaddr*)&address, address_length) < 0) benchmark_fail("bind", errno);
+    if (type == SOCK_STREAM && listen(listener, options->connections * 2) < 0) benchmark_fail("listen", errno);
+    benchmark_epoll_watch(epoll, listener, type == SOCK_STREAM ? BENCHMARK_EPOLL_LISTENER : BENCHMARK_EPOLL_SERVER);
+
+    for (uint32_t index = 0; index < options->connections; index++)
+    {
+        benchmark_connection_t* connection = &state.connections[index];
+        connection->fd = benchmark_epoll_socket(options, type);
+        if (connect(connection->fd, (struct sockaddr*)&address, address_length) < 0) benchmark_fail("connect", errno);
+        benchmark_register(&state, connection);
+        benchmark_epoll_watch(epoll, connection->fd, BENCHMARK_EPOLL_CLIENT);
+    }
+    for (uint32_t index = 0; index < options->connections; index++)
+    {
+        benchmark_epoll_send(&state, &state.connections[index]);
+    }
+
+    struct epoll_event events[BENCHMARK_EPOLL_EVENTS];
+    uint64_t started = benchmark_now();
+    uint64_t measure_from = started + options->warmup_seconds * 1000000000ULL;
+    uint64_t measure_until = measure_from + options->duration_seconds * 1000000000ULL;
+    for (uint64_t now = started; now < measure_until; now = benchmark_now())
+    {
+        if (!state.measuring && now >= measure_from)
+        {
+            state.measuring = true;
+        }
+        int count = epoll_wait(epoll, events, BENCHMARK_EPOLL_EVENTS, 1);
+        for (int index = 0; index < count; index++)
+        {
+            uint64_t role = events[index].data.u64 & ~(uint64_t)UINT32_MAX;
+            int fd = (int)(events[index].data.u64 & UINT32_MAX);
+            if (role == BENCHMARK_EPOLL_LISTENER)
+            {
+                int accepted;
+                while ((accepted = accept(fd, NULL, NULL)) >= 0)
+                {
+                    if (options->protocol == BENCHMARK_PROTOCOL_TCP) setsockopt(accepted, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+                    benchmark_epoll_watch(epoll, accepted, BENCHMARK_EPOLL_SERVER);
+                }
+                continue;
+            }
+            if (role == BENCHMARK_EPOLL_SERVER)
+            {
+                benchmark_epoll_handle_server(&state, fd);
+                continue;
+            }
+            benchmark_epoll_handle_client(&state, fd);
+        }
+    }
+
+    benchmark_report(&state, "epoll", options->duration_seconds);
+    for (uint32_t index = 0; index < options->connections; index++)
+    {
+        close(state.connections[index].fd);
+    }
+    close(listener);
+    close(epoll);
+    benchmark_state_destroy(&state);
+}
+
+int main(int argc, char** argv)
+{
+    benchmark_options_t options;
+    benchmark_parse_options(argc, argv, &options);
+    if (options.engines & BENCHMARK_ENGINE_IO_URING)
+    {
+        benchmark_io_uring(&options);
+    }
+    if (options.engines & BENCHMARK_ENGINE_EPOLL)
+    {
+        benchmark_epoll(&options);
+    }
+    if (options.protocol == BENCHMARK_PROTOCOL_UNIX)
+    {
+        unlink(options.path);
+    }
+    return EXIT_SUCCESS;
+}
@@ -15,6 +15,7 @@ int transport_client_initialize_tcp(transport_client_t* client,
                                     int32_t port)
 {
     client->family = INET;
+    client->options_count = 0;
     memset(&client->inet_destination_address, 0, sizeof(client->inet_destination_address));
     client->inet_destination_address.sin_addr.s_addr = inet_addr(ip);
     client->inet_destination_address.sin_port = htons(port);
@@ -40,6 +41,43 @@ int transport_client_initialize_tcp(transport_client_t* client,
     return 0;
 }
 
+void transport_client_prepare_tcp(transport_client_t* client,
+                                  transport_client_configuration_t* configuration,
+                                  const char* ip,
+                                  int32_t port)
+{
+    client->fd = -1;
+    client->family = INET;
+    memset(&client->inet_destination_address, 0, sizeof(client->inet_destination_address));
+    client->inet_destination_address.sin_addr.s_addr = inet_addr(ip);
+    client->inet_destination_address.sin_port = htons(port);
+    client->inet_destination_address.sin_family = AF_INET;
+    client->client_address_length = sizeof(client->inet_destination_address);
+    client->socket_domain = AF_INET;
+    client->socket_type = transport_socket_tcp_type(configuration->socket_configuration_flags);
+    client->socket_protocol = IPPROTO_TCP;
+    client->options_count = transport_socket_collect_tcp_options(
+        client->options,
+        configuration->socket_configuration_flags,
+        configuration->socket_receive_buffer_size,
+        configuration->socket_send_buffer_size,
+        configuration->socket_receive_low_at,
+        configuration->socket_send_low_at,
+        configuration->ip_ttl,
+        configuration->tcp_keep_alive_idle,
+        configuration->tcp_keep_alive_max_count,
+        configuration->tcp_keep_alive_individual_count,
+        configuration->tcp_max_segment_size,
+        configuration->tcp_syn_count);
+}
+
+int64_t transport_client_apply_options(transport_client_t* client)
+{
+    int64_t result = transport_socket_apply_options(client->fd, client->options, client->options_count);
+    client->options_count = 0;
+    return result;
+}
+
 int transport_client_initialize_udp(transport_client_t* client,
                                     transport_client_configuration_t* configuration,
                                     const char* destination_ip,
@@ -105,6 +143,64 @@ int transport_client_initialize_unix_stream(transport_client_t* client,
     return 0;
 }
 
+int transport_client_initialize_unix_datagram(transport_client_t* client,
+                                              transport_client_configuration_t* configuration,
+                                              const char* destination_path,
+                                              const char* source_path)
+{
+    client->family = UNIX;
+    client->client_address_length = sizeof(struct sockaddr_un);
+
+    memset(&client->unix_destination_address, 0, sizeof(client->unix_destination_address));
+    client->unix_destination_address.sun_family = AF_UNIX;
+    strcpy(client->unix_destination_address.sun_path, destination_path);
+
+    memset(&client->unix_source_address, 0, sizeof(client->unix_source_address));
+    client->unix_source_address.sun_family = AF_UNIX;
+    strcpy(client->unix_source_address.sun_path, source_path);
+    int64_t result = transport_socket_create_unix_datagram(
+        configuration->socket_configuration_flags,
+        configuration->socket_receive_buffer_size,
+        configuration->socket_send_buffer_size,
+        configuration->socket_receive_low_at,
+        configuration->socket_send_low_at);
+    if (result < 0)
+    {
+        return result;
+    }
+    client->fd = result;
+    result = bind(client->fd, (struct sockaddr*)&client->unix_source_address, client->client_address_length);
+    if (result < 0)
+    {
+        return result;
+    }
+
+    return 0;
+}
+
+int transport_client_initialize_unix_seqpacket(transport_client_t* client,
+                                               transport_client_configuration_t* configuration,
+                                               const char* path)
+{
+    client->family = UNIX;
+    memset(&client->unix_destination_address, 0, sizeof(client->unix_destination_address));
+    client->unix_destination_address.sun_family = AF_UNIX;
+    strcpy(client->unix_destination_address.sun_path, path);
+    client->client_address_length = sizeof(client->unix_destination_address);
+    int64_t result = transport_socket_create_unix_seqpacket(
+        configuration->socket_configuration_flags,
+        configuration->socket_receive_buffer_size,
+        configuration->socket_send_buffer_size,
+        configuration->socket_receive_low_at,
+        configuration->socket_send_low_at);
+    if (result < 0)
+    {
+        return result;
+    }
+    client->fd = result;
+    return 0;
+}
+
 struct sockaddr* transport_client_get_destination_address(transport_client_t* client)
 {
     return client->family == INET ? (struct sockaddr*)&client->inet_destination_address : (struct sockaddr*)&client->unix_destination_address;
@@ -112,13 +208,9 @@ struct sockaddr* transport_client_get_destination_address(transport_client_t* cl
 
 void transport_client_destroy(transport_client_t* client)
 {
-    if (client->family == UNIX)
+    if (client->family == UNIX && strlen(client->unix_source_address.sun_path))
     {
-        unlink(client->unix_destination_address.sun_path);
-        if (strlen(client->unix_source_address.sun_path))
-        {
-            unlink(client->unix_source_address.sun_path);
-        }
+        unlink(client->unix_source_address.sun_path);
     }
     free(client);
 }
\ No newline at end of file
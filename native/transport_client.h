@@ -6,6 +6,7 @@
 #include <stdint.h>
 #include <sys/un.h>
 #include "transport_constants.h"
+#include "transport_socket.h"
 
 #if defined(__cplusplus)
 extern "C"
@@ -38,12 +39,22 @@ extern "C"
         struct sockaddr_un unix_source_address;
         socklen_t client_address_length;
         transport_socket_family_t family;
+        int socket_domain;
+        int socket_type;
+        int socket_protocol;
+        transport_socket_option_t options[TRANSPORT_SOCKET_OPTIONS_MAX];
+        uint32_t options_count;
     } transport_client_t;
 
     int transport_client_initialize_tcp(transport_client_t* client,
                                         transport_client_configuration_t* configuration,
                                         const char* ip,
                                         int32_t port);
+    void transport_client_prepare_tcp(transport_client_t* client,
+                                      transport_client_configuration_t* configuration,
+                                      const char* ip,
+                                      int32_t port);
+    int64_t transport_client_apply_options(transport_client_t* client);
 
     int transport_client_initialize_udp(transport_client_t* client,
                                         transport_client_configuration_t* configuration,
@@ -55,6 +66,13 @@ extern "C"
     int transport_client_initialize_unix_stream(transport_client_t* client,
                                                 transport_client_configuration_t* configuration,
                                                 const char* path);
+    int transport_client_initialize_unix_datagram(transport_client_t* client,
+                                                  transport_client_configuration_t* configuration,
+                                                  const char* destination_path,
+                                                  const char* source_path);
+    int transport_client_initialize_unix_seqpacket(transport_client_t* client,
+                                                   transport_client_configuration_t* configuration,
+                                                   const char* path);
 
     struct sockaddr* transport_client_get_destination_address(transport_client_t* client);
 
@@ -15,6 +15,7 @@ extern "C"
     mh_key_t data;
     int64_t timeout;
     uint64_t timestamp;
+    uint64_t started;
     int fd;
   };
 
@@ -9,6 +9,8 @@ extern "C"
 #include <liburing.h>
 #include "common/common.h"
 
+#define TRANSPORT_MESSAGE_CONTROL_SIZE (CMSG_SPACE(sizeof(int)) + CMSG_SPACE(sizeof(struct timespec) * 3))
+
     static inline struct io_uring_sqe* transport_provide_sqe(struct io_uring* ring)
     {
         struct io_uring_sqe* sqe = io_uring_get_sqe(ring);
@@ -15,6 +15,13 @@ extern "C"
 #define TRANSPORT_EVENT_CLIENT ((uint16_t)1 << 6)
 #define TRANSPORT_EVENT_FILE ((uint16_t)1 << 7)
 #define TRANSPORT_EVENT_SERVER ((uint16_t)1 << 8)
+#define TRANSPORT_EVENT_SYNC ((uint16_t)1 << 9)
+#define TRANSPORT_EVENT_ALLOCATE ((uint16_t)1 << 10)
+#define TRANSPORT_EVENT_ADVISE ((uint16_t)1 << 11)
+#define TRANSPORT_EVENT_MESSAGE ((uint16_t)1 << 12)
+#define TRANSPORT_EVENT_SHARED ((uint16_t)1 << 13)
+#define TRANSPORT_EVENT_SOCKET ((uint16_t)1 << 14)
+#define TRANSPORT_EVENT_SLOT ((uint16_t)1 << 15)
 
 #define TRANSPORT_READ_ONLY (1 << 0)
 #define TRANSPORT_WRITE_ONLY (1 << 1)
@@ -54,6 +61,9 @@ extern "C"
 #define TRANSPORT_SOCKET_OPTION_TCP_MAXSEG ((uint64_t)1 << 27)
 #define TRANSPORT_SOCKET_OPTION_TCP_NODELAY ((uint64_t)1 << 28)
 #define TRANSPORT_SOCKET_OPTION_TCP_SYNCNT ((uint64_t)1 << 29)
+#define TRANSPORT_SOCKET_OPTION_UDP_GRO ((uint64_t)1 << 30)
+#define TRANSPORT_SOCKET_OPTION_SOCKET_TIMESTAMPING ((uint64_t)1 << 31)
+#define TRANSPORT_SOCKET_OPTION_TCP_FASTOPEN_CONNECT ((uint64_t)1 << 32)
 
   typedef enum transport_socket_family
   {
@@ -61,6 +71,18 @@ extern "C"
     UNIX,
   } transport_socket_family_t;
 
+  typedef enum transport_operation
+  {
+    TRANSPORT_OPERATION_READ = 0,
+    TRANSPORT_OPERATION_WRITE,
+    TRANSPORT_OPERATION_RECEIVE_MESSAGE,
+    TRANSPORT_OPERATION_SEND_MESSAGE,
+    TRANSPORT_OPERATION_CONNECT,
+    TRANSPORT_OPERATION_ACCEPT,
+    TRANSPORT_OPERATION_FILE,
+    TRANSPORT_OPERATIONS_COUNT,
+  } transport_operation_t;
+
 #if defined(__cplusplus)
 }
 #endif
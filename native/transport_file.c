@@ -1,5 +1,7 @@
 #include "transport_file.h"
+#include <errno.h>
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <unistd.h>
 #include "transport_constants.h"
 
@@ -35,4 +37,31 @@ int transport_file_open(const char* path, int mode, bool truncate, bool create)
         options |= O_CREAT;
     }
     return open(path, options, 0666);
-}
\ No newline at end of file
+}
+void* transport_file_map(int fd, size_t size)
+{
+    void* address = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    if (address == MAP_FAILED)
+    {
+        return NULL;
+    }
+    return address;
+}
+
+int transport_file_unmap(void* address, size_t size)
+{
+    if (munmap(address, size))
+    {
+        return -errno;
+    }
+    return 0;
+}
+
+int transport_file_advise(void* address, size_t size, int advice)
+{
+    if (madvise(address, size, advice))
+    {
+        return -errno;
+    }
+    return 0;
+}
@@ -1,12 +1,16 @@
 #ifndef TRANSPORT_FILE_H_INCLUDED
 #define TRANSPORT_FILE_H_INCLUDED
 #include <stdbool.h>
+#include <stddef.h>
 
 #if defined(__cplusplus)
 extern "C"
 {
 #endif
     int transport_file_open(const char* path, int mode, bool truncate, bool create);
+    void* transport_file_map(int fd, size_t size);
+    int transport_file_unmap(void* address, size_t size);
+    int transport_file_advise(void* address, size_t size, int advice);
 #if defined(__cplusplus)
 }
 #endif
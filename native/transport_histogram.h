@@ -0,0 +1,80 @@
+#ifndef TRANSPORT_HISTOGRAM_INCLUDED
+#define TRANSPORT_HISTOGRAM_INCLUDED
+
+#include <stdint.h>
+#include <string.h>
+
+#define TRANSPORT_HISTOGRAM_SUB_BUCKET_BITS 4
+#define TRANSPORT_HISTOGRAM_SUB_BUCKETS (1 << TRANSPORT_HISTOGRAM_SUB_BUCKET_BITS)
+#define TRANSPORT_HISTOGRAM_BUCKETS ((64 - TRANSPORT_HISTOGRAM_SUB_BUCKET_BITS + 1) * TRANSPORT_HISTOGRAM_SUB_BUCKETS)
+
+typedef struct transport_histogram
+{
+    uint64_t count;
+    uint64_t sum;
+    uint64_t min;
+    uint64_t max;
+    uint64_t buckets[TRANSPORT_HISTOGRAM_BUCKETS];
+} transport_histogram_t;
+
+static inline void transport_histogram_reset(transport_histogram_t* histogram)
+{
+    memset(histogram, 0, sizeof(transport_histogram_t));
+    histogram->min = UINT64_MAX;
+}
+
+static inline uint32_t transport_histogram_index(uint64_t value)
+{
+    if (value < TRANSPORT_HISTOGRAM_SUB_BUCKETS)
+    {
+        return (uint32_t)value;
+    }
+    uint32_t shift = 63 - __builtin_clzll(value) - TRANSPORT_HISTOGRAM_SUB_BUCKET_BITS;
+    return (shift + 1) * TRANSPORT_HISTOGRAM_SUB_BUCKETS + (uint32_t)((value >> shift) & (TRANSPORT_HISTOGRAM_SUB_BUCKETS - 1));
+}
+
+static inline void transport_histogram_record(transport_histogram_t* histogram, uint64_t value)
+{
+    histogram->buckets[transport_histogram_index(value)]++;
+    histogram->count++;
+    histogram->sum += value;
+    if (value < histogram->min) histogram->min = value;
+    if (value > histogram->max) histogram->max = value;
+}
+
+static inline uint64_t transport_histogram_upper_bound(uint32_t index)
+{
+    if (index < TRANSPORT_HISTOGRAM_SUB_BUCKETS)
+    {
+        return index;
+    }
+    uint32_t shift = index / TRANSPORT_HISTOGRAM_SUB_BUCKETS - 1;
+    uint64_t mantissa = index % TRANSPORT_HISTOGRAM_SUB_BUCKETS;
+    uint64_t upper = (TRANSPORT_HISTOGRAM_SUB_BUCKETS + mantissa + 1) << shift;
+    return upper == 0 ? UINT64_MAX : upper - 1;
+}
+
+static inline uint64_t transport_histogram_percentile(transport_histogram_t* histogram, double quantile)
+{
+    if (histogram->count == 0)
+    {
+        return 0;
+    }
+    uint64_t rank = (uint64_t)(quantile * histogram->count + 0.999999);
+    if (rank < 1) rank = 1;
+    if (rank > histogram->count) rank = histogram->count;
+    uint64_t cumulative = 0;
+    for (uint32_t index = 0; index < TRANSPORT_HISTOGRAM_BUCKETS; index++)
+    {
+        cumulative += histogram->buckets[index];
+        if (cumulative >= rank)
+        {
+            uint64_t upper = transport_histogram_upper_bound(index);
+            if (upper < histogram->min) return histogram->min;
+            return upper > histogram->max ? histogram->max : upper;
+        }
+    }
+    return histogram->max;
+}
+
+#endif
@@ -0,0 +1,296 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include "transport_shared.h"
+#include <errno.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "transport_common.h"
+#include "transport_constants.h"
+
+static inline uint32_t transport_shared_round_capacity(uint32_t capacity)
+{
+    uint32_t size = (uint32_t)getpagesize();
+    while (size < capacity)
+    {
+        size <<= 1;
+    }
+    return size;
+}
+
+static inline size_t transport_shared_memory_size(uint32_t capacity)
+{
+    return (size_t)getpagesize() + 2 * (size_t)capacity;
+}
+
+static inline void transport_shared_map_rings(transport_shared_t* shared, bool owner)
+{
+    transport_shared_ring_t* first = (transport_shared_ring_t*)shared->memory;
+    transport_shared_ring_t* second = first + 1;
+    uint8_t* first_data = (uint8_t*)shared->memory + getpagesize();
+    uint8_t* second_data = first_data + shared->capacity;
+    shared->outbound = owner ? first : second;
+    shared->outbound_data = owner ? first_data : second_data;
+    shared->inbound = owner ? second : first;
+    shared->inbound_data = owner ? second_data : first_data;
+}
+
+static inline void transport_shared_signal(uint32_t* sequence, uint32_t* waiting)
+{
+    __atomic_fetch_add(sequence, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(waiting, __ATOMIC_SEQ_CST) && __atomic_exchange_n(waiting, 0, __ATOMIC_SEQ_CST))
+    {
+        syscall(SYS_futex, sequence, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+    }
+}
+
+int transport_shared_connect(const char* path)
+{
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        return -errno;
+    }
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, path, sizeof(address.sun_path) - 1);
+    if (connect(fd, (struct sockaddr*)&address, sizeof(address)) < 0)
+    {
+        int error = -errno;
+        close(fd);
+        return error;
+    }
+    return fd;
+}
+
+int transport_shared_create(transport_shared_t* shared, int fd, uint32_t capacity)
+{
+    shared->fd = fd;
+    shared->capacity = transport_shared_round_capacity(capacity);
+    shared->memory_size = transport_shared_memory_size(shared->capacity);
+    shared->memory = NULL;
+    shared->memory_fd = memfd_create("transport-shared", MFD_CLOEXEC);
+    if (shared->memory_fd < 0)
+    {
+        return -errno;
+    }
+    if (ftruncate(shared->memory_fd, shared->memory_size))
+    {
+        return -errno;
+    }
+    void* memory = mmap(NULL, shared->memory_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, shared->memory_fd, 0);
+    if (memory == MAP_FAILED)
+    {
+        return -errno;
+    }
+    shared->memory = memory;
+    transport_shared_map_rings(shared, true);
+    shared->outbound->capacity = shared->capacity;
+    shared->inbound->capacity = shared->capacity;
+    return 0;
+}
+
+int transport_shared_send(transport_shared_t* shared)
+{
+    uint32_t capacity = shared->capacity;
+    struct iovec payload = {
+        .iov_base = &capacity,
+        .iov_len = sizeof(capacity),
+    };
+    union
+    {
+        char buffer[CMSG_SPACE(sizeof(int))];
+        struct cmsghdr alignment;
+    } control;
+    memset(&control, 0, sizeof(control));
+    struct msghdr message = {
+        .msg_iov = &payload,
+        .msg_iovlen = 1,
+        .msg_control = control.buffer,
+        .msg_controllen = sizeof(control.buffer),
+    };
+    struct cmsghdr* header = CMSG_FIRSTHDR(&message);
+    header->cmsg_level = SOL_SOCKET;
+    header->cmsg_type = SCM_RIGHTS;
+    header->cmsg_len = CMSG_LEN(sizeof(int));
+    memcpy(CMSG_DATA(header), &shared->memory_fd, sizeof(int));
+    return sendmsg(shared->fd, &message, MSG_NOSIGNAL) < 0 ? -errno : 0;
+}
+
+void transport_shared_receive(transport_shared_t* shared, transport_worker_t* worker, int fd, uint16_t buffer_id, int64_t timeout)
+{
+    shared->fd = fd;
+    shared->memory_fd = -1;
+    shared->memory = NULL;
+    memset(worker->unix_used_messages[buffer_id].msg_control, 0, TRANSPORT_MESSAGE_CONTROL_SIZE);
+    transport_worker_receive_message(worker, fd, buffer_id, UNIX, MSG_CMSG_CLOEXEC, timeout, TRANSPORT_EVENT_RECEIVE_MESSAGE | TRANSPORT_EVENT_SHARED, 0);
+}
+
+int transport_shared_attach(transport_shared_t* shared, transport_worker_t* worker, uint16_t buffer_id)
+{
+    struct msghdr* message = &worker->unix_used_messages[buffer_id];
+    if (message->msg_controllen > TRANSPORT_MESSAGE_CONTROL_SIZE)
+    {
+        message->msg_controllen = TRANSPORT_MESSAGE_CONTROL_SIZE;
+    }
+    int result = message->msg_flags & MSG_CTRUNC ? -EPROTO : 0;
+    int received = -1;
+    for (struct cmsghdr* header = CMSG_FIRSTHDR(message); header != NULL && header->cmsg_len != 0; header = CMSG_NXTHDR(message, header))
+    {
+        if (header->cmsg_level != SOL_SOCKET || header->cmsg_type != SCM_RIGHTS || header->cmsg_len < CMSG_LEN(sizeof(int)))
+        {
+            result = -EPROTO;
+            continue;
+        }
+        size_t count = (header->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        for (size_t index = 0; index < count; index++)
+        {
+            int fd;
+            memcpy(&fd, CMSG_DATA(header) + index * sizeof(int), sizeof(int));
+            if (received < 0)
+            {
+                received = fd;
+                continue;
+            }
+            close(fd);
+            result = -EPROTO;
+        }
+    }
+    if (received < 0)
+    {
+        return -EPROTO;
+    }
+    if (result)
+    {
+        close(received);
+        return result;
+    }
+    shared->memory_fd = received;
+    memcpy(&shared->capacity, worker->buffers[buffer_id].iov_base, sizeof(uint32_t));
+    shared->memory_size = transport_shared_memory_size(shared->capacity);
+    struct stat status;
+    if (fstat(shared->memory_fd, &status))
+    {
+        return -errno;
+    }
+    if (shared->capacity == 0 || (shared->capacity & (shared->capacity - 1)) || (size_t)status.st_size < shared->memory_size)
+    {
+        return -EPROTO;
+    }
+    void* memory = mmap(NULL, shared->memory_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, shared->memory_fd, 0);
+    if (memory == MAP_FAILED)
+    {
+        return -errno;
+    }
+    shared->memory = memory;
+    transport_shared_map_rings(shared, false);
+    return 0;
+}
+
+int32_t transport_shared_read(transport_shared_t* shared, transport_worker_t* worker, uint16_t buffer_id)
+{
+    transport_shared_ring_t* ring = shared->inbound;
+    uint32_t closed = __atomic_load_n(&ring->closed, __ATOMIC_ACQUIRE);
+    uint64_t head = ring->head;
+    uint64_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    if (tail == head)
+    {
+        return closed ? 0 : -EAGAIN;
+    }
+    uint32_t length = (uint32_t)(tail - head) < worker->buffer_size ? (uint32_t)(tail - head) : worker->buffer_size;
+    uint32_t offset = (uint32_t)(head & (shared->capacity - 1));
+    uint32_t first = shared->capacity - offset < length ? shared->capacity - offset : length;
+    struct iovec* buffer = &worker->buffers[buffer_id];
+    memcpy(buffer->iov_base, shared->inbound_data + offset, first);
+    memcpy((uint8_t*)buffer->iov_base + first, shared->inbound_data, length - first);
+    buffer->iov_len = length;
+    __atomic_store_n(&ring->head, head + length, __ATOMIC_SEQ_CST);
+    transport_shared_signal(&ring->writable, &ring->producer_waiting);
+    return (int32_t)length;
+}
+
+int32_t transport_shared_write(transport_shared_t* shared, transport_worker_t* worker, uint16_t buffer_id)
+{
+    transport_shared_ring_t* ring = shared->outbound;
+    struct iovec* buffer = &worker->buffers[buffer_id];
+    uint32_t length = (uint32_t)buffer->iov_len;
+    if (__atomic_load_n(&ring->closed, __ATOMIC_ACQUIRE))
+    {
+        return -EPIPE;
+    }
+    if (length > shared->capacity)
+    {
+        return -EMSGSIZE;
+    }
+    uint64_t tail = ring->tail;
+    uint64_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    if (shared->capacity - (tail - head) < length)
+    {
+        return -EAGAIN;
+    }
+    uint32_t offset = (uint32_t)(tail & (shared->capacity - 1));
+    uint32_t first = shared->capacity - offset < length ? shared->capacity - offset : length;
+    memcpy(shared->outbound_data + offset, buffer->iov_base, first);
+    memcpy(shared->outbound_data, (uint8_t*)buffer->iov_base + first, length - first);
+    __atomic_store_n(&ring->tail, tail + length, __ATOMIC_SEQ_CST);
+    transport_shared_signal(&ring->readable, &ring->consumer_waiting);
+    return (int32_t)length;
+}
+
+bool transport_shared_wait_readable(transport_shared_t* shared, transport_worker_t* worker, uint16_t buffer_id, int64_t timeout)
+{
+    transport_shared_ring_t* ring = shared->inbound;
+    uint32_t sequence = __atomic_load_n(&ring->readable, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&ring->consumer_waiting, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&ring->tail, __ATOMIC_SEQ_CST) != ring->head || __atomic_load_n(&ring->closed, __ATOMIC_SEQ_CST))
+    {
+        __atomic_store_n(&ring->consumer_waiting, 0, __ATOMIC_SEQ_CST);
+        return false;
+    }
+    transport_worker_wait(worker, shared->fd, buffer_id, &ring->readable, sequence, timeout, TRANSPORT_EVENT_READ | TRANSPORT_EVENT_SHARED);
+    return true;
+}
+
+bool transport_shared_wait_writable(transport_shared_t* shared, transport_worker_t* worker, uint16_t buffer_id, int64_t timeout)
+{
+    transport_shared_ring_t* ring = shared->outbound;
+    uint32_t length = (uint32_t)worker->buffers[buffer_id].iov_len;
+    uint32_t sequence = __atomic_load_n(&ring->writable, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&ring->producer_waiting, 1, __ATOMIC_SEQ_CST);
+    if (shared->capacity - (ring->tail - __atomic_load_n(&ring->head, __ATOMIC_SEQ_CST)) >= length || __atomic_load_n(&ring->closed, __ATOMIC_SEQ_CST))
+    {
+        __atomic_store_n(&ring->producer_waiting, 0, __ATOMIC_SEQ_CST);
+        return false;
+    }
+    transport_worker_wait(worker, shared->fd, buffer_id, &ring->writable, sequence, timeout, TRANSPORT_EVENT_WRITE | TRANSPORT_EVENT_SHARED);
+    return true;
+}
+
+void transport_shared_destroy(transport_shared_t* shared)
+{
+    if (shared->memory != NULL)
+    {
+        __atomic_store_n(&shared->outbound->closed, 1, __ATOMIC_RELEASE);
+        __atomic_store_n(&shared->inbound->closed, 1, __ATOMIC_RELEASE);
+        transport_shared_signal(&shared->outbound->readable, &shared->outbound->consumer_waiting);
+        transport_shared_signal(&shared->inbound->writable, &shared->inbound->producer_waiting);
+        munmap(shared->memory, shared->memory_size);
+    }
+    if (shared->memory_fd >= 0)
+    {
+        close(shared->memory_fd);
+    }
+    if (shared->fd >= 0)
+    {
+        close(shared->fd);
+    }
+    free(shared);
+}
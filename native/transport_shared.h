@@ -0,0 +1,60 @@
+#ifndef TRANSPORT_SHARED_H_INCLUDED
+#define TRANSPORT_SHARED_H_INCLUDED
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "transport_worker.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+#define TRANSPORT_SHARED_CACHE_LINE 64
+
+    typedef struct transport_shared_ring
+    {
+        uint64_t head __attribute__((aligned(TRANSPORT_SHARED_CACHE_LINE)));
+        uint32_t writable;
+        uint32_t consumer_waiting;
+        uint64_t tail __attribute__((aligned(TRANSPORT_SHARED_CACHE_LINE)));
+        uint32_t readable;
+        uint32_t producer_waiting;
+        uint32_t capacity __attribute__((aligned(TRANSPORT_SHARED_CACHE_LINE)));
+        uint32_t closed;
+    } transport_shared_ring_t;
+
+    typedef struct transport_shared
+    {
+        int fd;
+        int memory_fd;
+        void* memory;
+        size_t memory_size;
+        uint32_t capacity;
+        transport_shared_ring_t* inbound;
+        transport_shared_ring_t* outbound;
+        uint8_t* inbound_data;
+        uint8_t* outbound_data;
+    } transport_shared_t;
+
+    int transport_shared_connect(const char* path);
+
+    int transport_shared_create(transport_shared_t* shared, int fd, uint32_t capacity);
+    int transport_shared_send(transport_shared_t* shared);
+    void transport_shared_receive(transport_shared_t* shared, transport_worker_t* worker, int fd, uint16_t buffer_id, int64_t timeout);
+    int transport_shared_attach(transport_shared_t* shared, transport_worker_t* worker, uint16_t buffer_id);
+
+    int32_t transport_shared_read(transport_shared_t* shared, transport_worker_t* worker, uint16_t buffer_id);
+    int32_t transport_shared_write(transport_shared_t* shared, transport_worker_t* worker, uint16_t buffer_id);
+
+    bool transport_shared_wait_readable(transport_shared_t* shared, transport_worker_t* worker, uint16_t buffer_id, int64_t timeout);
+    bool transport_shared_wait_writable(transport_shared_t* shared, transport_worker_t* worker, uint16_t buffer_id, int64_t timeout);
+
+    void transport_shared_destroy(transport_shared_t* shared);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
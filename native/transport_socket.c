@@ -1,187 +1,186 @@
 #include "transport_socket.h"
 #include <arpa/inet.h>
+#include <errno.h>
 #include <fcntl.h>
+#include <linux/net_tstamp.h>
+#include <linux/tls.h>
 #include <net/if.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
+#include <netinet/udp.h>
 #include <stdint.h>
+#include <string.h>
 #include <sys/socket.h>
 #include <unistd.h>
 #include "transport_constants.h"
 
-int64_t transport_socket_create_tcp(uint64_t flags,
-                                    uint32_t socket_receive_buffer_size,
-                                    uint32_t socket_send_buffer_size,
-                                    uint32_t socket_receive_low_at,
-                                    uint32_t socket_send_low_at,
-                                    uint16_t ip_ttl,
-                                    uint32_t tcp_keep_alive_idle,
-                                    uint32_t tcp_keep_alive_max_count,
-                                    uint32_t tcp_keep_alive_individual_count,
-                                    uint32_t tcp_max_segment_size,
-                                    uint16_t tcp_syn_count)
+static inline void transport_socket_add_option(transport_socket_option_t* options, uint32_t* count, uint64_t flag, int level, int name, int value)
 {
-    int activate_option = 1;
-    int deactivate_option = 0;
-
-    int fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
-    if (fd == -1)
-    {
-        return -1;
-    }
+    options[*count].flag = flag;
+    options[*count].level = level;
+    options[*count].name = name;
+    options[*count].value = value;
+    (*count)++;
+}
 
-    if (flags & TRANSPORT_SOCKET_OPTION_SOCKET_NONBLOCK)
-    {
-        int fcntl_flags = fcntl(fd, F_GETFL);
-        if (fcntl_flags < 0)
-        {
-            return -TRANSPORT_SOCKET_OPTION_SOCKET_NONBLOCK;
-        }
-        if (fcntl(fd, F_SETFL, fcntl_flags | O_NONBLOCK) < 0)
-        {
-            return -TRANSPORT_SOCKET_OPTION_SOCKET_NONBLOCK;
-        }
-    }
-    if (flags & TRANSPORT_SOCKET_OPTION_SOCKET_CLOCEXEC)
-    {
-        int fcntl_flags = fcntl(fd, F_GETFL);
-        if (fcntl_flags < 0)
-        {
-            return -TRANSPORT_SOCKET_OPTION_SOCKET_CLOCEXEC;
-        }
-        if (fcntl(fd, F_SETFL, fcntl_flags | O_CLOEXEC) < 0)
-        {
-            return -TRANSPORT_SOCKET_OPTION_SOCKET_CLOCEXEC;
-        }
-    }
+uint32_t transport_socket_collect_tcp_options(transport_socket_option_t* options,
+                                              uint64_t flags,
+                                              uint32_t socket_receive_buffer_size,
+                                              uint32_t socket_send_buffer_size,
+                                              uint32_t socket_receive_low_at,
+                                              uint32_t socket_send_low_at,
+                                              uint16_t ip_ttl,
+                                              uint32_t tcp_keep_alive_idle,
+                                              uint32_t tcp_keep_alive_max_count,
+                                              uint32_t tcp_keep_alive_individual_count,
+                                              uint32_t tcp_max_segment_size,
+                                              uint16_t tcp_syn_count)
+{
+    uint32_t count = 0;
     if (flags & TRANSPORT_SOCKET_OPTION_SOCKET_REUSEADDR)
     {
-        if (setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &activate_option, sizeof(int)))
-        {
-            return -TRANSPORT_SOCKET_OPTION_SOCKET_REUSEADDR;
-        }
+        transport_socket_add_option(options, &count, TRANSPORT_SOCKET_OPTION_SOCKET_REUSEADDR, SOL_SOCKET, SO_REUSEADDR, 1);
     }
     if (flags & TRANSPORT_SOCKET_OPTION_SOCKET_REUSEPORT)
     {
-        if (setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &activate_option, sizeof(int)))
-        {
-            return -TRANSPORT_SOCKET_OPTION_SOCKET_REUSEPORT;
-        }
+        transport_socket_add_option(options, &count, TRANSPORT_SOCKET_OPTION_SOCKET_REUSEPORT, SOL_SOCKET, SO_REUSEPORT, 1);
     }
     if (flags & TRANSPORT_SOCKET_OPTION_SOCKET_RCVBUF)
     {
-        if (setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &socket_receive_buffer_size, sizeof(socket_receive_buffer_size)))
-        {
-            return -TRANSPORT_SOCKET_OPTION_SOCKET_RCVBUF;
-        }
+        transport_socket_add_option(options, &count, TRANSPORT_SOCKET_OPTION_SOCKET_RCVBUF, SOL_SOCKET, SO_RCVBUF, socket_receive_buffer_size);
     }
     if (flags & TRANSPORT_SOCKET_OPTION_SOCKET_SNDBUF)
     {
-        if (setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &socket_send_buffer_size, sizeof(socket_send_buffer_size)))
-        {
-            return -TRANSPORT_SOCKET_OPTION_SOCKET_SNDBUF;
-        }
+        transport_socket_add_option(options, &count, TRANSPORT_SOCKET_OPTION_SOCKET_SNDBUF, SOL_SOCKET, SO_SNDBUF, socket_send_buffer_size);
     }
     if (flags & TRANSPORT_SOCKET_OPTION_SOCKET_KEEPALIVE)
     {
-        if (setsockopt(fd, SOL_SOCKET, SO_KEEPALIVE, &activate_option, sizeof(int)))
-        {
-            return -TRANSPORT_SOCKET_OPTION_SOCKET_KEEPALIVE;
-        }
+        transport_socket_add_option(options, &count, TRANSPORT_SOCKET_OPTION_SOCKET_KEEPALIVE, SOL_SOCKET, SO_KEEPALIVE, 1);
     }
     if (flags & TRANSPORT_SOCKET_OPTION_SOCKET_RCVLOWAT)
     {
-        if (setsockopt(fd, SOL_SOCKET, SO_RCVLOWAT, &socket_receive_low_at, sizeof(socket_receive_low_at)))
-        {
-            return -TRANSPORT_SOCKET_OPTION_SOCKET_RCVLOWAT;
-        }
+        transport_socket_add_option(options, &count, TRANSPORT_SOCKET_OPTION_SOCKET_RCVLOWAT, SOL_SOCKET, SO_RCVLOWAT, socket_receive_low_at);
     }
     if (flags & TRANSPORT_SOCKET_OPTION_SOCKET_SNDLOWAT)
     {
-        if (setsockopt(fd, SOL_SOCKET, SO_SNDLOWAT, &socket_send_low_at, sizeof(socket_send_low_at)))
-        {
-            return -TRANSPORT_SOCKET_OPTION_SOCKET_SNDLOWAT;
-        }
+        transport_socket_add_option(options, &count, TRANSPORT_SOCKET_OPTION_SOCKET_SNDLOWAT, SOL_SOCKET, SO_SNDLOWAT, socket_send_low_at);
     }
 
     if (flags & TRANSPORT_SOCKET_OPTION_IP_TTL)
     {
-        if (setsockopt(fd, SOL_IP, IP_TTL, &ip_ttl, sizeof(ip_ttl)))
-        {
-            return -TRANSPORT_SOCKET_OPTION_IP_TTL;
-        }
+        transport_socket_add_option(options, &count, TRANSPORT_SOCKET_OPTION_IP_TTL, SOL_IP, IP_TTL, ip_ttl);
     }
     if (flags & TRANSPORT_SOCKET_OPTION_IP_FREEBIND)
     {
-        if (setsockopt(fd, SOL_IP, IP_FREEBIND, &activate_option, sizeof(activate_option)))
-        {
-            return -TRANSPORT_SOCKET_OPTION_IP_FREEBIND;
-        }
+        transport_socket_add_option(options, &count, TRANSPORT_SOCKET_OPTION_IP_FREEBIND, SOL_IP, IP_FREEBIND, 1);
     }
 
     if (flags & TRANSPORT_SOCKET_OPTION_TCP_QUICKACK)
     {
-        if (setsockopt(fd, SOL_TCP, TCP_QUICKACK, &activate_option, sizeof(activate_option)))
-        {
-            return -TRANSPORT_SOCKET_OPTION_TCP_QUICKACK;
-        }
+        transport_socket_add_option(options, &count, TRANSPORT_SOCKET_OPTION_TCP_QUICKACK, SOL_TCP, TCP_QUICKACK, 1);
     }
     if (flags & TRANSPORT_SOCKET_OPTION_TCP_DEFER_ACCEPT)
     {
-        if (setsockopt(fd, SOL_TCP, TCP_DEFER_ACCEPT, &activate_option, sizeof(activate_option)))
-        {
-            return -TRANSPORT_SOCKET_OPTION_TCP_DEFER_ACCEPT;
-        }
+        transport_socket_add_option(options, &count, TRANSPORT_SOCKET_OPTION_TCP_DEFER_ACCEPT, SOL_TCP, TCP_DEFER_ACCEPT, 1);
     }
     if (flags & TRANSPORT_SOCKET_OPTION_TCP_FASTOPEN)
     {
-        if (setsockopt(fd, SOL_TCP, TCP_FASTOPEN, &activate_option, sizeof(activate_option)))
-        {
-            return -TRANSPORT_SOCKET_OPTION_TCP_FASTOPEN;
-        }
+        transport_socket_add_option(options, &count, TRANSPORT_SOCKET_OPTION_TCP_FASTOPEN, SOL_TCP, TCP_FASTOPEN, 1);
+    }
+    if (flags & TRANSPORT_SOCKET_OPTION_TCP_FASTOPEN_CONNECT)
+    {
+        transport_socket_add_option(options, &count, TRANSPORT_SOCKET_OPTION_TCP_FASTOPEN_CONNECT, SOL_TCP, TCP_FASTOPEN_CONNECT, 1);
     }
     if (flags & TRANSPORT_SOCKET_OPTION_TCP_KEEPIDLE)
     {
-        if (setsockopt(fd, SOL_TCP, TCP_KEEPIDLE, &tcp_keep_alive_idle, sizeof(tcp_keep_alive_idle)))
-        {
-            return -TRANSPORT_SOCKET_OPTION_TCP_KEEPIDLE;
-        }
+        transport_socket_add_option(options, &count, TRANSPORT_SOCKET_OPTION_TCP_KEEPIDLE, SOL_TCP, TCP_KEEPIDLE, tcp_keep_alive_idle);
     }
     if (flags & TRANSPORT_SOCKET_OPTION_TCP_KEEPCNT)
     {
-        if (setsockopt(fd, SOL_TCP, TCP_KEEPCNT, &tcp_keep_alive_max_count, sizeof(tcp_keep_alive_max_count)))
-        {
-            return -TRANSPORT_SOCKET_OPTION_TCP_KEEPCNT;
-        }
+        transport_socket_add_option(options, &count, TRANSPORT_SOCKET_OPTION_TCP_KEEPCNT, SOL_TCP, TCP_KEEPCNT, tcp_keep_alive_max_count);
     }
     if (flags & TRANSPORT_SOCKET_OPTION_TCP_KEEPINTVL)
     {
-        if (setsockopt(fd, SOL_TCP, TCP_KEEPINTVL, &tcp_keep_alive_individual_count, sizeof(tcp_keep_alive_individual_count)))
-        {
-            return -TRANSPORT_SOCKET_OPTION_TCP_KEEPINTVL;
-        }
+        transport_socket_add_option(options, &count, TRANSPORT_SOCKET_OPTION_TCP_KEEPINTVL, SOL_TCP, TCP_KEEPINTVL, tcp_keep_alive_individual_count);
     }
     if (flags & TRANSPORT_SOCKET_OPTION_TCP_MAXSEG)
     {
-        if (setsockopt(fd, SOL_TCP, TCP_MAXSEG, &tcp_max_segment_size, sizeof(tcp_max_segment_size)))
-        {
-            return -TRANSPORT_SOCKET_OPTION_TCP_MAXSEG;
-        }
+        transport_socket_add_option(options, &count, TRANSPORT_SOCKET_OPTION_TCP_MAXSEG, SOL_TCP, TCP_MAXSEG, tcp_max_segment_size);
     }
     if (flags & TRANSPORT_SOCKET_OPTION_TCP_NODELAY)
     {
-        if (setsockopt(fd, SOL_TCP, TCP_NODELAY, &activate_option, sizeof(activate_option)))
-        {
-            return -TRANSPORT_SOCKET_OPTION_TCP_NODELAY;
-        }
+        transport_socket_add_option(options, &count, TRANSPORT_SOCKET_OPTION_TCP_NODELAY, SOL_TCP, TCP_NODELAY, 1);
     }
     if (flags & TRANSPORT_SOCKET_OPTION_TCP_SYNCNT)
     {
-        if (setsockopt(fd, SOL_TCP, TCP_SYNCNT, &tcp_syn_count, sizeof(tcp_syn_count)))
+        transport_socket_add_option(options, &count, TRANSPORT_SOCKET_OPTION_TCP_SYNCNT, SOL_TCP, TCP_SYNCNT, tcp_syn_count);
+    }
+
+    return count;
+}
+
+int64_t transport_socket_apply_options(int fd, transport_socket_option_t* options, uint32_t count)
+{
+    for (uint32_t index = 0; index < count; index++)
+    {
+        if (setsockopt(fd, options[index].level, options[index].name, &options[index].value, sizeof(options[index].value)))
         {
-            return -TRANSPORT_SOCKET_OPTION_TCP_SYNCNT;
+            return -options[index].flag;
         }
     }
+    return 0;
+}
+
+int transport_socket_tcp_type(uint64_t flags)
+{
+    int type = SOCK_STREAM;
+    if (flags & TRANSPORT_SOCKET_OPTION_SOCKET_NONBLOCK)
+    {
+        type |= SOCK_NONBLOCK;
+    }
+    if (flags & TRANSPORT_SOCKET_OPTION_SOCKET_CLOCEXEC)
+    {
+        type |= SOCK_CLOEXEC;
+    }
+    return type;
+}
+
+int64_t transport_socket_create_tcp(uint64_t flags,
+                                    uint32_t socket_receive_buffer_size,
+                                    uint32_t socket_send_buffer_size,
+                                    uint32_t socket_receive_low_at,
+                                    uint32_t socket_send_low_at,
+                                    uint16_t ip_ttl,
+                                    uint32_t tcp_keep_alive_idle,
+                                    uint32_t tcp_keep_alive_max_count,
+                                    uint32_t tcp_keep_alive_individual_count,
+                                    uint32_t tcp_max_segment_size,
+                                    uint16_t tcp_syn_count)
+{
+    int fd = socket(AF_INET, transport_socket_tcp_type(flags), IPPROTO_TCP);
+    if (fd == -1)
+    {
+        return -1;
+    }
+
+    transport_socket_option_t options[TRANSPORT_SOCKET_OPTIONS_MAX];
+    uint32_t count = transport_socket_collect_tcp_options(options,
+                                                          flags,
+                                                          socket_receive_buffer_size,
+                                                          socket_send_buffer_size,
+                                                          socket_receive_low_at,
+                                                          socket_send_low_at,
+                                                          ip_ttl,
+                                                          tcp_keep_alive_idle,
+                                                          tcp_keep_alive_max_count,
+                                                          tcp_keep_alive_individual_count,
+                                                          tcp_max_segment_size,
+                                                          tcp_syn_count);
+    int64_t result = transport_socket_apply_options(fd, options, count);
+    if (result < 0)
+    {
+        return result;
+    }
 
     return fd;
 }
@@ -318,11 +317,27 @@ int64_t transport_socket_create_udp(uint64_t flags,
             return -TRANSPORT_SOCKET_OPTION_IP_MULTICAST_TTL;
         }
     }
+    if (flags & TRANSPORT_SOCKET_OPTION_UDP_GRO)
+    {
+        if (setsockopt(fd, SOL_UDP, UDP_GRO, &activate_option, sizeof(activate_option)))
+        {
+            return -TRANSPORT_SOCKET_OPTION_UDP_GRO;
+        }
+    }
+    if (flags & TRANSPORT_SOCKET_OPTION_SOCKET_TIMESTAMPING)
+    {
+        int timestamping_flags = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE | SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE;
+        if (setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPING, &timestamping_flags, sizeof(timestamping_flags)))
+        {
+            return -TRANSPORT_SOCKET_OPTION_SOCKET_TIMESTAMPING;
+        }
+    }
 
     return fd;
 }
 
-int64_t transport_socket_create_unix_stream(uint64_t flags,
+static int64_t transport_socket_create_unix(int type,
+                                            uint64_t flags,
                                             uint32_t socket_receive_buffer_size,
                                             uint32_t socket_send_buffer_size,
                                             uint32_t socket_receive_low_at,
@@ -330,7 +345,7 @@ int64_t transport_socket_create_unix_stream(uint64_t flags,
 {
     int activate_option = 1;
 
-    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    int fd = socket(AF_UNIX, type, 0);
     if (fd == -1)
     {
         return -1;
@@ -399,6 +414,33 @@ int64_t transport_socket_create_unix_stream(uint64_t flags,
     return fd;
 }
 
+int64_t transport_socket_create_unix_stream(uint64_t flags,
+                                            uint32_t socket_receive_buffer_size,
+                                            uint32_t socket_send_buffer_size,
+                                            uint32_t socket_receive_low_at,
+                                            uint32_t socket_send_low_at)
+{
+    return transport_socket_create_unix(SOCK_STREAM, flags, socket_receive_buffer_size, socket_send_buffer_size, socket_receive_low_at, socket_send_low_at);
+}
+
+int64_t transport_socket_create_unix_datagram(uint64_t flags,
+                                              uint32_t socket_receive_buffer_size,
+                                              uint32_t socket_send_buffer_size,
+                                              uint32_t socket_receive_low_at,
+                                              uint32_t socket_send_low_at)
+{
+    return transport_socket_create_unix(SOCK_DGRAM, flags, socket_receive_buffer_size, socket_send_buffer_size, socket_receive_low_at, socket_send_low_at);
+}
+
+int64_t transport_socket_create_unix_seqpacket(uint64_t flags,
+                                               uint32_t socket_receive_buffer_size,
+                                               uint32_t socket_send_buffer_size,
+                                               uint32_t socket_receive_low_at,
+                                               uint32_t socket_send_low_at)
+{
+    return transport_socket_create_unix(SOCK_SEQPACKET, flags, socket_receive_buffer_size, socket_send_buffer_size, socket_receive_low_at, socket_send_low_at);
+}
+
 int transport_socket_multicast_add_membership(int fd, const char* group_address, const char* local_address, int interface_index)
 {
     struct ip_mreqn request;
@@ -445,4 +487,85 @@ void transport_socket_initialize_multicast_request(struct ip_mreqn* request, con
     request->imr_multiaddr.s_addr = inet_addr(group_address);
     request->imr_address.s_addr = inet_addr(local_address);
     request->imr_ifindex = interface_index;
-}
\ No newline at end of file
+}
+
+int transport_socket_enable_tls(int fd)
+{
+    if (setsockopt(fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) < 0)
+    {
+        return -errno;
+    }
+    return 0;
+}
+
+int transport_socket_set_tls_keys(int fd,
+                                  bool receive,
+                                  uint16_t version,
+                                  uint16_t cipher,
+                                  const uint8_t* key,
+                                  size_t key_length,
+                                  const uint8_t* iv,
+                                  size_t iv_length,
+                                  const uint8_t* salt,
+                                  size_t salt_length,
+                                  const uint8_t* sequence)
+{
+    union
+    {
+        struct tls12_crypto_info_aes_gcm_128 aes_gcm_128;
+        struct tls12_crypto_info_aes_gcm_256 aes_gcm_256;
+        struct tls12_crypto_info_chacha20_poly1305 chacha20_poly1305;
+    } crypto_info;
+    socklen_t crypto_info_length;
+    memset(&crypto_info, 0, sizeof(crypto_info));
+
+    switch (cipher)
+    {
+        case TLS_CIPHER_AES_GCM_128:
+            if (key_length != TLS_CIPHER_AES_GCM_128_KEY_SIZE || iv_length != TLS_CIPHER_AES_GCM_128_IV_SIZE || salt_length != TLS_CIPHER_AES_GCM_128_SALT_SIZE)
+            {
+                return -EINVAL;
+            }
+            crypto_info.aes_gcm_128.info.version = version;
+            crypto_info.aes_gcm_128.info.cipher_type = cipher;
+            memcpy(crypto_info.aes_gcm_128.key, key, key_length);
+            memcpy(crypto_info.aes_gcm_128.iv, iv, iv_length);
+            memcpy(crypto_info.aes_gcm_128.salt, salt, salt_length);
+            memcpy(crypto_info.aes_gcm_128.rec_seq, sequence, TLS_CIPHER_AES_GCM_128_REC_SEQ_SIZE);
+            crypto_info_length = sizeof(crypto_info.aes_gcm_128);
+            break;
+        case TLS_CIPHER_AES_GCM_256:
+            if (key_length != TLS_CIPHER_AES_GCM_256_KEY_SIZE || iv_length != TLS_CIPHER_AES_GCM_256_IV_SIZE || salt_length != TLS_CIPHER_AES_GCM_256_SALT_SIZE)
+            {
+                return -EINVAL;
+            }
+            crypto_info.aes_gcm_256.info.version = version;
+            crypto_info.aes_gcm_256.info.cipher_type = cipher;
+            memcpy(crypto_info.aes_gcm_256.key, key, key_length);
+            memcpy(crypto_info.aes_gcm_256.iv, iv, iv_length);
+            memcpy(crypto_info.aes_gcm_256.salt, salt, salt_length);
+            memcpy(crypto_info.aes_gcm_256.rec_seq, sequence, TLS_CIPHER_AES_GCM_256_REC_SEQ_SIZE);
+            crypto_info_length = sizeof(crypto_info.aes_gcm_256);
+            break;
+        case TLS_CIPHER_CHACHA20_POLY1305:
+            if (key_length != TLS_CIPHER_CHACHA20_POLY1305_KEY_SIZE || iv_length != TLS_CIPHER_CHACHA20_POLY1305_IV_SIZE || salt_length != TLS_CIPHER_CHACHA20_POLY1305_SALT_SIZE)
+            {
+                return -EINVAL;
+            }
+            crypto_info.chacha20_poly1305.info.version = version;
+            crypto_info.chacha20_poly1305.info.cipher_type = cipher;
+            memcpy(crypto_info.chacha20_poly1305.key, key, key_length);
+            memcpy(crypto_info.chacha20_poly1305.iv, iv, iv_length);
+            memcpy(crypto_info.chacha20_poly1305.rec_seq, sequence, TLS_CIPHER_CHACHA20_POLY1305_REC_SEQ_SIZE);
+            crypto_info_length = sizeof(crypto_info.chacha20_poly1305);
+            break;
+        default:
+            return -EINVAL;
+    }
+
+    if (setsockopt(fd, SOL_TLS, receive ? TLS_RX : TLS_TX, &crypto_info, crypto_info_length) < 0)
+    {
+        return -errno;
+    }
+    return 0;
+}
@@ -3,12 +3,38 @@
 
 #include <netinet/in.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #if defined(__cplusplus)
 extern "C"
 {
 #endif
+#define TRANSPORT_SOCKET_OPTIONS_MAX 24
+
+    typedef struct transport_socket_option
+    {
+        uint64_t flag;
+        int level;
+        int name;
+        int value;
+    } transport_socket_option_t;
+
+    uint32_t transport_socket_collect_tcp_options(transport_socket_option_t* options,
+                                                  uint64_t flags,
+                                                  uint32_t socket_receive_buffer_size,
+                                                  uint32_t socket_send_buffer_size,
+                                                  uint32_t socket_receive_low_at,
+                                                  uint32_t socket_send_low_at,
+                                                  uint16_t ip_ttl,
+                                                  uint32_t tcp_keep_alive_idle,
+                                                  uint32_t tcp_keep_alive_max_count,
+                                                  uint32_t tcp_keep_alive_individual_count,
+                                                  uint32_t tcp_max_segment_size,
+                                                  uint16_t tcp_syn_count);
+    int64_t transport_socket_apply_options(int fd, transport_socket_option_t* options, uint32_t count);
+    int transport_socket_tcp_type(uint64_t flags);
+
     int64_t transport_socket_create_tcp(uint64_t flags,
                                         uint32_t socket_receive_buffer_size,
                                         uint32_t socket_send_buffer_size,
@@ -33,6 +59,16 @@ extern "C"
                                                 uint32_t socket_send_buffer_size,
                                                 uint32_t socket_receive_low_at,
                                                 uint32_t socket_send_low_at);
+    int64_t transport_socket_create_unix_datagram(uint64_t flags,
+                                                  uint32_t socket_receive_buffer_size,
+                                                  uint32_t socket_send_buffer_size,
+                                                  uint32_t socket_receive_low_at,
+                                                  uint32_t socket_send_low_at);
+    int64_t transport_socket_create_unix_seqpacket(uint64_t flags,
+                                                   uint32_t socket_receive_buffer_size,
+                                                   uint32_t socket_send_buffer_size,
+                                                   uint32_t socket_receive_low_at,
+                                                   uint32_t socket_send_low_at);
 
     void transport_socket_initialize_multicast_request(struct ip_mreqn* request, const char* group_address, const char* local_address, int interface_index);
 
@@ -44,6 +80,19 @@ extern "C"
 
     int transport_socket_get_interface_index(const char* interface);
 
+    int transport_socket_enable_tls(int fd);
+    int transport_socket_set_tls_keys(int fd,
+                                      bool receive,
+                                      uint16_t version,
+                                      uint16_t cipher,
+                                      const uint8_t* key,
+                                      size_t key_length,
+                                      const uint8_t* iv,
+                                      size_t iv_length,
+                                      const uint8_t* salt,
+                                      size_t salt_length,
+                                      const uint8_t* sequence);
+
 #if defined(__cplusplus)
 }
 #endif
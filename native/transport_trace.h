@@ -0,0 +1,84 @@
+#ifndef TRANSPORT_TRACE_INCLUDED
+#define TRANSPORT_TRACE_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "common/common.h"
+
+typedef enum transport_trace_kind
+{
+    TRANSPORT_TRACE_SUBMIT = 0,
+    TRANSPORT_TRACE_COMPLETE,
+    TRANSPORT_TRACE_CANCEL,
+} transport_trace_kind_t;
+
+typedef struct transport_trace_entry
+{
+    uint64_t timestamp;
+    uint64_t data;
+    int32_t result;
+    uint32_t kind;
+} transport_trace_entry_t;
+
+struct transport_trace
+{
+    transport_trace_entry_t* entries;
+    uint64_t position;
+    uint32_t mask;
+};
+
+static inline int transport_trace_create(struct transport_trace* trace, uint32_t capacity)
+{
+    trace->position = 0;
+    trace->mask = 0;
+    trace->entries = NULL;
+    if (capacity == 0)
+    {
+        return 0;
+    }
+    uint32_t size = 1;
+    while (size < capacity)
+    {
+        size <<= 1;
+    }
+    trace->entries = (transport_trace_entry_t*)calloc(size, sizeof(transport_trace_entry_t));
+    trace->mask = size - 1;
+    return (trace->entries == NULL ? -1 : 0);
+}
+
+static inline void transport_trace_destroy(struct transport_trace* trace)
+{
+    free(trace->entries);
+    trace->entries = NULL;
+}
+
+static inline void transport_trace_record(struct transport_trace* trace, transport_trace_kind_t kind, uint64_t timestamp, uint64_t data, int32_t result)
+{
+    if (unlikely(trace->entries == NULL))
+        return;
+    transport_trace_entry_t* entry = &trace->entries[trace->position++ & trace->mask];
+    entry->timestamp = timestamp;
+    entry->data = data;
+    entry->result = result;
+    entry->kind = kind;
+}
+
+static inline size_t transport_trace_dump(struct transport_trace* trace, transport_trace_entry_t* target, size_t capacity)
+{
+    if (trace->entries == NULL)
+        return 0;
+    uint64_t size = (uint64_t)trace->mask + 1;
+    uint64_t count = trace->position < size ? trace->position : size;
+    if (count > capacity)
+        count = capacity;
+    uint64_t start = trace->position - count;
+    for (uint64_t index = 0; index < count; index++)
+    {
+        target[index] = trace->entries[(start + index) & trace->mask];
+    }
+    return count;
+}
+
+#endif
@@ -1,8 +1,107 @@
 #include "transport_worker.h"
+#include <linux/futex.h>
+#include <netinet/udp.h>
+#include <sys/socket.h>
+#include <time.h>
 #include <unistd.h>
 #include "transport_common.h"
 #include "transport_constants.h"
 
+#ifndef FUTEX2_SIZE_U32
+#define FUTEX2_SIZE_U32 0x02
+#endif
+
+#ifndef SOCKET_URING_OP_SETSOCKOPT
+#define SOCKET_URING_OP_SETSOCKOPT 3
+#endif
+
+static bool transport_worker_probe_socket_options(transport_worker_t* worker)
+{
+    int fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, IPPROTO_TCP);
+    if (fd < 0)
+    {
+        return false;
+    }
+    int value = 1;
+    bool supported = false;
+    struct io_uring_cqe* cqe;
+    struct io_uring_sqe* sqe = io_uring_get_sqe(worker->ring);
+    io_uring_prep_cmd_sock(sqe, SOCKET_URING_OP_SETSOCKOPT, fd, SOL_SOCKET, SO_KEEPALIVE, &value, sizeof(value));
+    io_uring_sqe_set_data64(sqe, 0);
+    if (io_uring_submit_and_wait(worker->ring, 1) == 1 && io_uring_wait_cqe(worker->ring, &cqe) == 0)
+    {
+        supported = cqe->res == 0;
+        io_uring_cqe_seen(worker->ring, cqe);
+    }
+    close(fd);
+    return supported;
+}
+
+static int transport_worker_create_buffer(transport_worker_t* worker, size_t index)
+{
+    if (posix_memalign(&worker->buffers[index].iov_base, getpagesize(), worker->buffer_size))
+    {
+        worker->buffers[index].iov_base = NULL;
+        return -ENOMEM;
+    }
+    memset(worker->buffers[index].iov_base, 0, worker->buffer_size);
+    worker->buffers[index].iov_len = worker->buffer_size;
+
+    memset(&worker->inet_used_messages[index], 0, sizeof(struct msghdr));
+    memset(&worker->unix_used_messages[index], 0, sizeof(struct msghdr));
+
+    worker->inet_used_messages[index].msg_name = malloc(sizeof(struct sockaddr_in));
+    worker->inet_used_messages[index].msg_namelen = sizeof(struct sockaddr_in);
+    worker->inet_used_messages[index].msg_control = malloc(TRANSPORT_MESSAGE_CONTROL_SIZE);
+    worker->unix_used_messages[index].msg_name = malloc(sizeof(struct sockaddr_un));
+    worker->unix_used_messages[index].msg_namelen = sizeof(struct sockaddr_un);
+    worker->unix_used_messages[index].msg_control = malloc(TRANSPORT_MESSAGE_CONTROL_SIZE);
+    if (!worker->inet_used_messages[index].msg_name ||
+        !worker->inet_used_messages[index].msg_control ||
+        !worker->unix_used_messages[index].msg_name ||
+        !worker->unix_used_messages[index].msg_control)
+    {
+        return -ENOMEM;
+    }
+    return 0;
+}
+
+static void transport_worker_free_buffer(transport_worker_t* worker, size_t index)
+{
+    free(worker->buffers[index].iov_base);
+    free(worker->inet_used_messages[index].msg_name);
+    free(worker->inet_used_messages[index].msg_control);
+    free(worker->unix_used_messages[index].msg_name);
+    free(worker->unix_used_messages[index].msg_control);
+    worker->buffers[index].iov_base = NULL;
+    worker->buffers[index].iov_len = 0;
+    memset(&worker->inet_used_messages[index], 0, sizeof(struct msghdr));
+    memset(&worker->unix_used_messages[index], 0, sizeof(struct msghdr));
+}
+
+static int transport_worker_grow_slots(transport_worker_t* worker, uint32_t count)
+{
+    uint32_t capacity = worker->slots_capacity + (count > worker->slots_capacity ? count : worker->slots_capacity);
+    if (capacity <= worker->slots_capacity || capacity > TRANSPORT_WORKER_SLOT_NONE)
+    {
+        return -ENOMEM;
+    }
+    transport_worker_slot_t* slots = realloc(worker->slots, sizeof(transport_worker_slot_t) * capacity);
+    if (!slots)
+    {
+        return -ENOMEM;
+    }
+    memset(&slots[worker->slots_capacity], 0, sizeof(transport_worker_slot_t) * (capacity - worker->slots_capacity));
+    for (uint32_t index = capacity; index > worker->slots_capacity; index--)
+    {
+        slots[index - 1].next = worker->slots_free;
+        worker->slots_free = index - 1;
+    }
+    worker->slots = slots;
+    worker->slots_capacity = capacity;
+    return 0;
+}
+
 int transport_worker_initialize(transport_worker_t* worker,
                                 transport_worker_configuration_t* configuration,
                                 uint8_t id)
@@ -13,34 +112,65 @@ int transport_worker_initialize(transport_worker_t* worker,
     worker->base_delay_micros = configuration->base_delay_micros;
     worker->max_delay_micros = configuration->max_delay_micros;
     worker->buffer_size = configuration->buffer_size;
+    if (configuration->buffers_count > TRANSPORT_WORKER_BUFFERS_LIMIT)
+    {
+        return -EINVAL;
+    }
     worker->buffers_count = configuration->buffers_count;
+    worker->buffers_initial_count = configuration->buffers_count;
+    worker->buffers_max_count = configuration->buffers_max_count > configuration->buffers_count ? configuration->buffers_max_count : configuration->buffers_count;
+    if (worker->buffers_max_count > TRANSPORT_WORKER_BUFFERS_LIMIT)
+    {
+        worker->buffers_max_count = TRANSPORT_WORKER_BUFFERS_LIMIT;
+    }
+    worker->buffers_grow_occupancy = configuration->buffers_grow_occupancy;
+    worker->buffers_shrink_occupancy = configuration->buffers_shrink_occupancy;
     worker->timeout_checker_period_millis = configuration->timeout_checker_period_millis;
     worker->cqes = malloc(sizeof(struct io_uring_cqe) * worker->ring_size);
-    worker->buffers = malloc(sizeof(struct iovec) * configuration->buffers_count);
+    worker->buffers = calloc(worker->buffers_max_count, sizeof(struct iovec));
     worker->cqe_wait_timeout_millis = configuration->cqe_wait_timeout_millis;
     worker->cqe_wait_count = configuration->cqe_wait_count;
     worker->cqe_peek_count = configuration->cqe_peek_count;
     worker->trace = configuration->trace;
-    if (!worker->buffers)
+    worker->reap_timestamp = 0;
+    worker->metrics = aligned_alloc(TRANSPORT_WORKER_METRICS_ALIGNMENT, sizeof(transport_worker_metrics_t));
+    worker->reap_monotonic = 0;
+    worker->latencies = malloc(sizeof(transport_histogram_t) * TRANSPORT_OPERATIONS_COUNT);
+    if (!worker->buffers || !worker->metrics || !worker->latencies)
+    {
+        return -ENOMEM;
+    }
+    memset(worker->metrics, 0, sizeof(transport_worker_metrics_t));
+    for (int operation = 0; operation < TRANSPORT_OPERATIONS_COUNT; operation++)
+    {
+        transport_histogram_reset(&worker->latencies[operation]);
+    }
+
+    worker->slots = NULL;
+    worker->slots_capacity = 0;
+    worker->slots_free = TRANSPORT_WORKER_SLOT_NONE;
+    worker->slots_used = 0;
+    worker->slots_chain_failed = false;
+    if (transport_worker_grow_slots(worker, worker->buffers_count))
     {
         return -ENOMEM;
     }
+    worker->handles = NULL;
+    worker->handles_capacity = 0;
 
-    worker->events = mh_events_new();
-    if (!worker->events)
+    if (transport_trace_create(&worker->trace_ring, configuration->trace ? configuration->trace_capacity : 0))
     {
         return -ENOMEM;
     }
-    mh_events_reserve(worker->events, worker->buffers_count, 0);
 
-    int result = transport_buffers_pool_create(&worker->free_buffers, configuration->buffers_count);
+    int result = transport_buffers_pool_create(&worker->free_buffers, worker->buffers_max_count);
     if (result == -1)
     {
         return -ENOMEM;
     }
 
-    worker->inet_used_messages = malloc(sizeof(struct msghdr) * configuration->buffers_count);
-    worker->unix_used_messages = malloc(sizeof(struct msghdr) * configuration->buffers_count);
+    worker->inet_used_messages = calloc(worker->buffers_max_count, sizeof(struct msghdr));
+    worker->unix_used_messages = calloc(worker->buffers_max_count, sizeof(struct msghdr));
 
     if (!worker->inet_used_messages || !worker->unix_used_messages)
     {
@@ -49,29 +179,10 @@ int transport_worker_initialize(transport_worker_t* worker,
 
     for (size_t index = 0; index < configuration->buffers_count; index++)
     {
-        if (posix_memalign(&worker->buffers[index].iov_base, getpagesize(), configuration->buffer_size))
+        if (transport_worker_create_buffer(worker, index))
         {
             return -ENOMEM;
         }
-        memset(worker->buffers[index].iov_base, 0, configuration->buffer_size);
-        worker->buffers[index].iov_len = configuration->buffer_size;
-
-        memset(&worker->inet_used_messages[index], 0, sizeof(struct msghdr));
-        worker->inet_used_messages[index].msg_name = malloc(sizeof(struct sockaddr_in));
-        if (!worker->inet_used_messages[index].msg_name)
-        {
-            return -ENOMEM;
-        }
-        worker->inet_used_messages[index].msg_namelen = sizeof(struct sockaddr_in);
-
-        memset(&worker->unix_used_messages[index], 0, sizeof(struct msghdr));
-        worker->unix_used_messages[index].msg_name = malloc(sizeof(struct sockaddr_un));
-        if (!worker->unix_used_messages[index].msg_name)
-        {
-            return -ENOMEM;
-        }
-        worker->unix_used_messages[index].msg_namelen = sizeof(struct sockaddr_un);
-
         transport_buffers_pool_push(&worker->free_buffers, index);
     }
     worker->ring = malloc(sizeof(struct io_uring));
@@ -85,10 +196,32 @@ int transport_worker_initialize(transport_worker_t* worker,
         return result;
     }
 
-    result = io_uring_register_buffers(worker->ring, worker->buffers, worker->buffers_count);
-    if (result)
+    worker->buffers_sparse = false;
+    if (worker->buffers_max_count > worker->buffers_count && io_uring_register_buffers_sparse(worker->ring, worker->buffers_max_count) == 0)
     {
-        return result;
+        result = io_uring_register_buffers_update_tag(worker->ring, 0, worker->buffers, NULL, worker->buffers_count);
+        if (result < 0)
+        {
+            return result;
+        }
+        worker->buffers_sparse = true;
+    }
+    else
+    {
+        worker->buffers_max_count = worker->buffers_count;
+        result = io_uring_register_buffers(worker->ring, worker->buffers, worker->buffers_count);
+        if (result)
+        {
+            return result;
+        }
+    }
+
+    struct io_uring_probe* probe = io_uring_get_probe_ring(worker->ring);
+    worker->ring_sockets = probe != NULL && io_uring_opcode_supported(probe, IORING_OP_SOCKET);
+    worker->ring_socket_options = probe != NULL && io_uring_opcode_supported(probe, IORING_OP_URING_CMD) && transport_worker_probe_socket_options(worker);
+    if (probe != NULL)
+    {
+        io_uring_free_probe(probe);
     }
 
     return 0;
@@ -109,6 +242,91 @@ int32_t transport_worker_used_buffers(transport_worker_t* worker)
     return worker->buffers_count - worker->free_buffers.count;
 }
 
+int32_t transport_worker_grow_buffers(transport_worker_t* worker, uint16_t count)
+{
+    uint32_t current = worker->buffers_count;
+    uint32_t target = current + count < worker->buffers_max_count ? current + count : worker->buffers_max_count;
+    if (!worker->buffers_sparse || target == current)
+    {
+        return current;
+    }
+    for (uint32_t index = current; index < target; index++)
+    {
+        if (transport_worker_create_buffer(worker, index))
+        {
+            for (uint32_t created = current; created <= index; created++)
+            {
+                transport_worker_free_buffer(worker, created);
+            }
+            return -ENOMEM;
+        }
+    }
+    int result = io_uring_register_buffers_update_tag(worker->ring, current, &worker->buffers[current], NULL, target - current);
+    if (result < 0)
+    {
+        for (uint32_t index = current; index < target; index++)
+        {
+            transport_worker_free_buffer(worker, index);
+        }
+        return result;
+    }
+    for (uint32_t index = target; index > current; index--)
+    {
+        transport_buffers_pool_push(&worker->free_buffers, index - 1);
+    }
+    worker->buffers_count = target;
+    return target;
+}
+
+int32_t transport_worker_shrink_buffers(transport_worker_t* worker, uint16_t count)
+{
+    uint32_t current = worker->buffers_count;
+    uint32_t target = current - worker->buffers_initial_count > count ? current - count : worker->buffers_initial_count;
+    if (!worker->buffers_sparse || target == current)
+    {
+        return current;
+    }
+    struct transport_buffers_pool* pool = &worker->free_buffers;
+    size_t released = 0;
+    for (size_t index = 0; index < pool->count; index++)
+    {
+        if ((uint32_t)pool->ids[index] >= target)
+        {
+            released++;
+        }
+    }
+    if (released != current - target)
+    {
+        return current;
+    }
+    struct iovec* unregistered = calloc(current - target, sizeof(struct iovec));
+    if (!unregistered)
+    {
+        return -ENOMEM;
+    }
+    int result = io_uring_register_buffers_update_tag(worker->ring, target, unregistered, NULL, current - target);
+    free(unregistered);
+    if (result < 0)
+    {
+        return result;
+    }
+    size_t kept = 0;
+    for (size_t index = 0; index < pool->count; index++)
+    {
+        if ((uint32_t)pool->ids[index] < target)
+        {
+            pool->ids[kept++] = pool->ids[index];
+        }
+    }
+    pool->count = kept;
+    for (uint32_t index = target; index < current; index++)
+    {
+        transport_worker_free_buffer(worker, index);
+    }
+    worker->buffers_count = target;
+    return target;
+}
+
 void transport_worker_release_buffer(transport_worker_t* worker, uint16_t buffer_id)
 {
     struct iovec* buffer = &worker->buffers[buffer_id];
@@ -117,65 +335,198 @@ void transport_worker_release_buffer(transport_worker_t* worker, uint16_t buffer
     transport_buffers_pool_push(&worker->free_buffers, buffer_id);
 }
 
-static inline void transport_worker_add_event(transport_worker_t* worker, int fd, uint64_t data, int64_t timeout)
+static inline struct io_uring_sqe* transport_worker_provide_sqe(transport_worker_t* worker)
 {
-    struct mh_events_node_t node = {
-        .data = data,
-        .timeout = timeout,
-        .timestamp = time(NULL),
-        .fd = fd,
-    };
-    mh_events_put(worker->events, &node, NULL, 0);
+    struct io_uring_sqe* sqe = io_uring_get_sqe(worker->ring);
+    while (unlikely(sqe == NULL))
+    {
+        struct io_uring_cqe* unused;
+        worker->metrics->sq_full_waits++;
+        io_uring_wait_cqe_nr(worker->ring, &unused, 1);
+        sqe = io_uring_get_sqe(worker->ring);
+    }
+    worker->metrics->sqes_prepared++;
+    return sqe;
+}
+
+static inline uint64_t transport_worker_monotonic_nanos()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+static inline transport_operation_t transport_worker_operation(uint64_t data)
+{
+    uint16_t event = (uint16_t)(data & 0xffff);
+    if (event & (TRANSPORT_EVENT_MESSAGE | TRANSPORT_EVENT_SHARED)) return TRANSPORT_OPERATIONS_COUNT;
+    if (event & TRANSPORT_EVENT_FILE) return TRANSPORT_OPERATION_FILE;
+    if (event & TRANSPORT_EVENT_READ) return TRANSPORT_OPERATION_READ;
+    if (event & TRANSPORT_EVENT_WRITE) return TRANSPORT_OPERATION_WRITE;
+    if (event & TRANSPORT_EVENT_RECEIVE_MESSAGE) return TRANSPORT_OPERATION_RECEIVE_MESSAGE;
+    if (event & TRANSPORT_EVENT_SEND_MESSAGE) return TRANSPORT_OPERATION_SEND_MESSAGE;
+    if (event & TRANSPORT_EVENT_CONNECT) return TRANSPORT_OPERATION_CONNECT;
+    if (event & TRANSPORT_EVENT_ACCEPT) return TRANSPORT_OPERATION_ACCEPT;
+    return TRANSPORT_OPERATIONS_COUNT;
+}
+
+static inline uint64_t transport_worker_route(transport_worker_t* worker, uint32_t fd, uint64_t data)
+{
+    uint32_t handle = fd < worker->handles_capacity ? worker->handles[fd] : 0;
+    return handle ? ((uint64_t)handle << 32) | (data & 0xffffffff) : data;
+}
+
+static inline uint64_t transport_worker_trace_data(transport_worker_slot_t* slot)
+{
+    return ((uint64_t)(uint32_t)slot->fd << 32) | (slot->data & 0xffffffff);
+}
+
+static inline uint64_t transport_worker_slot_data(uint32_t index, uint16_t generation, uint64_t data)
+{
+    return ((uint64_t)generation << TRANSPORT_WORKER_SLOT_GENERATION_SHIFT) | ((uint64_t)index << TRANSPORT_WORKER_SLOT_INDEX_SHIFT) | (data & 0xffff) | TRANSPORT_EVENT_SLOT;
+}
+
+static inline transport_worker_slot_t* transport_worker_find_slot(transport_worker_t* worker, uint64_t user_data)
+{
+    uint32_t index = (uint32_t)(user_data >> TRANSPORT_WORKER_SLOT_INDEX_SHIFT);
+    if (unlikely(index >= worker->slots_capacity))
+    {
+        return NULL;
+    }
+    transport_worker_slot_t* slot = &worker->slots[index];
+    if (unlikely(slot->state == TRANSPORT_WORKER_SLOT_FREE || slot->generation != (uint16_t)(user_data >> TRANSPORT_WORKER_SLOT_GENERATION_SHIFT)))
+    {
+        return NULL;
+    }
+    return slot;
+}
+
+static inline uint64_t transport_worker_event_data(transport_worker_t* worker, uint64_t user_data)
+{
+    if (!(user_data & TRANSPORT_EVENT_SLOT))
+    {
+        return user_data;
+    }
+    transport_worker_slot_t* slot = transport_worker_find_slot(worker, user_data);
+    return slot ? transport_worker_trace_data(slot) : 0;
+}
+
+static inline void transport_worker_add_event(transport_worker_t* worker, struct io_uring_sqe* sqe, int fd, uint64_t data, int64_t timeout, uint8_t sqe_flags)
+{
+    uint64_t started = transport_worker_monotonic_nanos();
+    transport_trace_record(&worker->trace_ring, TRANSPORT_TRACE_SUBMIT, started, data, 0);
+    bool chain_failed = worker->slots_chain_failed;
+    if (unlikely(chain_failed) || (unlikely(worker->slots_free == TRANSPORT_WORKER_SLOT_NONE) && transport_worker_grow_slots(worker, worker->slots_capacity)))
+    {
+        uint64_t routed = transport_worker_route(worker, fd, data);
+        io_uring_prep_msg_ring(sqe, worker->ring->ring_fd, (uint32_t)(chain_failed ? -ECANCELED : -ENOMEM), routed, 0);
+        io_uring_sqe_set_data64(sqe, routed);
+        sqe->flags = IOSQE_CQE_SKIP_SUCCESS;
+        worker->slots_chain_failed = sqe_flags & IOSQE_IO_LINK;
+        return;
+    }
+    uint32_t index = worker->slots_free;
+    transport_worker_slot_t* slot = &worker->slots[index];
+    worker->slots_free = slot->next;
+    worker->slots_used++;
+    slot->data = transport_worker_route(worker, fd, data);
+    slot->timeout = timeout;
+    slot->timestamp = time(NULL);
+    slot->started = started;
+    slot->fd = fd;
+    slot->state = TRANSPORT_WORKER_SLOT_ACTIVE;
+    io_uring_sqe_set_data64(sqe, transport_worker_slot_data(index, slot->generation, data));
+    sqe->flags |= sqe_flags;
 }
 
 void transport_worker_write(transport_worker_t* worker,
                             uint32_t fd,
                             uint16_t buffer_id,
-                            uint32_t offset,
+                            uint64_t offset,
                             int64_t timeout,
                             uint16_t event,
                             uint8_t sqe_flags)
 {
-    struct io_uring* ring = worker->ring;
-    struct io_uring_sqe* sqe = transport_provide_sqe(ring);
+    struct io_uring_sqe* sqe = transport_worker_provide_sqe(worker);
     uint64_t data = (((uint64_t)(fd) << 32) | (uint64_t)(buffer_id) << 16) | ((uint64_t)event);
     struct iovec* buffer = &worker->buffers[buffer_id];
     io_uring_prep_write_fixed(sqe, fd, buffer->iov_base, buffer->iov_len, offset, buffer_id);
-    io_uring_sqe_set_data64(sqe, data);
-    sqe->flags |= sqe_flags;
-    transport_worker_add_event(worker, fd, data, timeout);
+    transport_worker_add_event(worker, sqe, fd, data, timeout, sqe_flags);
 }
 
 void transport_worker_read(transport_worker_t* worker,
                            uint32_t fd,
                            uint16_t buffer_id,
-                           uint32_t offset,
+                           uint64_t offset,
                            int64_t timeout,
                            uint16_t event,
                            uint8_t sqe_flags)
 {
-    struct io_uring* ring = worker->ring;
-    struct io_uring_sqe* sqe = transport_provide_sqe(ring);
+    struct io_uring_sqe* sqe = transport_worker_provide_sqe(worker);
     uint64_t data = (((uint64_t)(fd) << 32) | (uint64_t)(buffer_id) << 16) | ((uint64_t)event);
     struct iovec* buffer = &worker->buffers[buffer_id];
     io_uring_prep_read_fixed(sqe, fd, buffer->iov_base, buffer->iov_len, offset, buffer_id);
-    io_uring_sqe_set_data64(sqe, data);
-    sqe->flags |= sqe_flags;
-    transport_worker_add_event(worker, fd, data, timeout);
+    transport_worker_add_event(worker, sqe, fd, data, timeout, sqe_flags);
 }
 
-void transport_worker_send_message(transport_worker_t* worker,
-                                   uint32_t fd,
-                                   uint16_t buffer_id,
-                                   struct sockaddr* address,
-                                   transport_socket_family_t socket_family,
-                                   int message_flags,
-                                   int64_t timeout,
-                                   uint16_t event,
-                                   uint8_t sqe_flags)
+void transport_worker_sync(transport_worker_t* worker,
+                           uint32_t fd,
+                           uint16_t buffer_id,
+                           bool data_only,
+                           int64_t timeout,
+                           uint16_t event,
+                           uint8_t sqe_flags)
+{
+    struct io_uring_sqe* sqe = transport_worker_provide_sqe(worker);
+    uint64_t data = (((uint64_t)(fd) << 32) | (uint64_t)(buffer_id) << 16) | ((uint64_t)event);
+    io_uring_prep_fsync(sqe, fd, data_only ? IORING_FSYNC_DATASYNC : 0);
+    transport_worker_add_event(worker, sqe, fd, data, timeout, sqe_flags);
+}
+
+void transport_worker_allocate(transport_worker_t* worker,
+                               uint32_t fd,
+                               uint16_t buffer_id,
+                               int mode,
+                               uint64_t offset,
+                               uint64_t length,
+                               int64_t timeout,
+                               uint16_t event,
+                               uint8_t sqe_flags)
+{
+    struct io_uring_sqe* sqe = transport_worker_provide_sqe(worker);
+    uint64_t data = (((uint64_t)(fd) << 32) | (uint64_t)(buffer_id) << 16) | ((uint64_t)event);
+    io_uring_prep_fallocate(sqe, fd, mode, offset, length);
+    transport_worker_add_event(worker, sqe, fd, data, timeout, sqe_flags);
+}
+
+void transport_worker_advise(transport_worker_t* worker,
+                             uint32_t fd,
+                             uint16_t buffer_id,
+                             void* address,
+                             uint64_t length,
+                             int advice,
+                             int64_t timeout,
+                             uint16_t event,
+                             uint8_t sqe_flags)
 {
-    struct io_uring* ring = worker->ring;
-    struct io_uring_sqe* sqe = transport_provide_sqe(ring);
+    struct io_uring_sqe* sqe = transport_worker_provide_sqe(worker);
+    uint64_t data = (((uint64_t)(fd) << 32) | (uint64_t)(buffer_id) << 16) | ((uint64_t)event);
+    io_uring_prep_madvise(sqe, address, length, advice);
+    transport_worker_add_event(worker, sqe, fd, data, timeout, sqe_flags);
+}
+
+static inline void transport_worker_prepare_send_message(transport_worker_t* worker,
+                                                        uint32_t fd,
+                                                        uint16_t buffer_id,
+                                                        struct sockaddr* address,
+                                                        transport_socket_family_t socket_family,
+                                                        int message_flags,
+                                                        uint16_t segment_size,
+                                                        int64_t timeout,
+                                                        uint16_t event,
+                                                        uint8_t sqe_flags)
+{
+    struct io_uring_sqe* sqe = transport_worker_provide_sqe(worker);
     uint64_t data = (((uint64_t)(fd) << 32) | (uint64_t)(buffer_id) << 16) | ((uint64_t)event);
     struct msghdr* message;
     if (socket_family == INET)
@@ -189,15 +540,48 @@ void transport_worker_send_message(transport_worker_t* worker,
         message->msg_namelen = SUN_LEN((struct sockaddr_un*)address);
         memcpy(message->msg_name, address, message->msg_namelen);
     }
-    message->msg_control = NULL;
     message->msg_controllen = 0;
+    if (segment_size)
+    {
+        message->msg_controllen = CMSG_SPACE(sizeof(uint16_t));
+        struct cmsghdr* control = CMSG_FIRSTHDR(message);
+        control->cmsg_level = SOL_UDP;
+        control->cmsg_type = UDP_SEGMENT;
+        control->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+        *(uint16_t*)CMSG_DATA(control) = segment_size;
+    }
     message->msg_iov = &worker->buffers[buffer_id];
     message->msg_iovlen = 1;
     message->msg_flags = 0;
     io_uring_prep_sendmsg(sqe, fd, message, message_flags);
-    io_uring_sqe_set_data64(sqe, data);
-    sqe->flags |= sqe_flags;
-    transport_worker_add_event(worker, fd, data, timeout);
+    transport_worker_add_event(worker, sqe, fd, data, timeout, sqe_flags);
+}
+
+void transport_worker_send_message(transport_worker_t* worker,
+                                   uint32_t fd,
+                                   uint16_t buffer_id,
+                                   struct sockaddr* address,
+                                   transport_socket_family_t socket_family,
+                                   int message_flags,
+                                   int64_t timeout,
+                                   uint16_t event,
+                                   uint8_t sqe_flags)
+{
+    transport_worker_prepare_send_message(worker, fd, buffer_id, address, socket_family, message_flags, 0, timeout, event, sqe_flags);
+}
+
+void transport_worker_send_message_segmented(transport_worker_t* worker,
+                                             uint32_t fd,
+                                             uint16_t buffer_id,
+                                             struct sockaddr* address,
+                                             transport_socket_family_t socket_family,
+                                             int message_flags,
+                                             uint16_t segment_size,
+                                             int64_t timeout,
+                                             uint16_t event,
+                                             uint8_t sqe_flags)
+{
+    transport_worker_prepare_send_message(worker, fd, buffer_id, address, socket_family, message_flags, segment_size, timeout, event, sqe_flags);
 }
 
 void transport_worker_receive_message(transport_worker_t* worker,
@@ -209,8 +593,7 @@ void transport_worker_receive_message(transport_worker_t* worker,
                                       uint16_t event,
                                       uint8_t sqe_flags)
 {
-    struct io_uring* ring = worker->ring;
-    struct io_uring_sqe* sqe = transport_provide_sqe(ring);
+    struct io_uring_sqe* sqe = transport_worker_provide_sqe(worker);
     uint64_t data = (((uint64_t)(fd) << 32) | (uint64_t)(buffer_id) << 16) | ((uint64_t)event);
     struct msghdr* message;
     if (socket_family == INET)
@@ -223,65 +606,109 @@ void transport_worker_receive_message(transport_worker_t* worker,
         message = &worker->unix_used_messages[buffer_id];
         message->msg_namelen = sizeof(struct sockaddr_un);
     }
-    message->msg_control = NULL;
-    message->msg_controllen = 0;
+    message->msg_controllen = TRANSPORT_MESSAGE_CONTROL_SIZE;
     memset(message->msg_name, 0, message->msg_namelen);
     message->msg_iov = &worker->buffers[buffer_id];
     message->msg_iovlen = 1;
     message->msg_flags = 0;
     io_uring_prep_recvmsg(sqe, fd, message, message_flags);
-    io_uring_sqe_set_data64(sqe, data);
-    sqe->flags |= sqe_flags;
-    transport_worker_add_event(worker, fd, data, timeout);
+    transport_worker_add_event(worker, sqe, fd, data, timeout, sqe_flags);
+}
+
+static inline void transport_worker_set_socket_options(transport_worker_t* worker, transport_client_t* client)
+{
+    uint64_t data = transport_worker_route(worker, client->fd, ((uint64_t)(client->fd) << 32) | ((uint64_t)TRANSPORT_EVENT_SOCKET | (uint64_t)TRANSPORT_EVENT_CLIENT));
+    for (uint32_t index = 0; index < client->options_count; index++)
+    {
+        transport_socket_option_t* option = &client->options[index];
+        struct io_uring_sqe* sqe = transport_worker_provide_sqe(worker);
+        io_uring_prep_cmd_sock(sqe, SOCKET_URING_OP_SETSOCKOPT, client->fd, option->level, option->name, &option->value, sizeof(option->value));
+        io_uring_sqe_set_data64(sqe, data | ((uint64_t)index << 16));
+        sqe->flags |= IOSQE_IO_LINK | IOSQE_CQE_SKIP_SUCCESS;
+    }
+    client->options_count = 0;
+}
+
+void transport_worker_socket(transport_worker_t* worker, transport_client_t* client, uint32_t slot)
+{
+    struct io_uring_sqe* sqe = transport_worker_provide_sqe(worker);
+    io_uring_prep_socket(sqe, client->socket_domain, client->socket_type, client->socket_protocol, 0);
+    io_uring_sqe_set_data64(sqe, ((uint64_t)slot << 32) | (uint64_t)TRANSPORT_EVENT_SOCKET);
 }
 
 void transport_worker_connect(transport_worker_t* worker, transport_client_t* client, int64_t timeout)
 {
-    struct io_uring* ring = worker->ring;
-    struct io_uring_sqe* sqe = transport_provide_sqe(ring);
+    transport_worker_set_socket_options(worker, client);
+    struct io_uring_sqe* sqe = transport_worker_provide_sqe(worker);
     uint64_t data = ((uint64_t)(client->fd) << 32) | ((uint64_t)TRANSPORT_EVENT_CONNECT | (uint64_t)TRANSPORT_EVENT_CLIENT);
     struct sockaddr* address = client->family == INET
                                    ? (struct sockaddr*)&client->inet_destination_address
                                    : (struct sockaddr*)&client->unix_destination_address;
     io_uring_prep_connect(sqe, client->fd, address, client->client_address_length);
-    io_uring_sqe_set_data64(sqe, data);
-    transport_worker_add_event(worker, client->fd, data, timeout);
+    transport_worker_add_event(worker, sqe, client->fd, data, timeout, 0);
+}
+
+void transport_worker_connect_with_data(transport_worker_t* worker, transport_client_t* client, uint16_t buffer_id, int64_t timeout)
+{
+    transport_worker_set_socket_options(worker, client);
+    struct io_uring_sqe* sqe = transport_worker_provide_sqe(worker);
+    uint64_t data = ((uint64_t)(client->fd) << 32) | ((uint64_t)TRANSPORT_EVENT_CONNECT | (uint64_t)TRANSPORT_EVENT_CLIENT);
+    struct sockaddr* address = client->family == INET
+                                   ? (struct sockaddr*)&client->inet_destination_address
+                                   : (struct sockaddr*)&client->unix_destination_address;
+    io_uring_prep_connect(sqe, client->fd, address, client->client_address_length);
+    transport_worker_add_event(worker, sqe, client->fd, data, timeout, IOSQE_IO_LINK);
+    transport_worker_write(worker, client->fd, buffer_id, 0, timeout, TRANSPORT_EVENT_WRITE | TRANSPORT_EVENT_CLIENT, 0);
 }
 
 void transport_worker_accept(transport_worker_t* worker, transport_server_t* server)
 {
-    struct io_uring* ring = worker->ring;
-    struct io_uring_sqe* sqe = transport_provide_sqe(ring);
+    struct io_uring_sqe* sqe = transport_worker_provide_sqe(worker);
     uint64_t data = ((uint64_t)(server->fd) << 32) | ((uint64_t)TRANSPORT_EVENT_ACCEPT | (uint64_t)TRANSPORT_EVENT_SERVER);
     struct sockaddr* address = server->family == INET
                                    ? (struct sockaddr*)&server->inet_server_address
                                    : (struct sockaddr*)&server->unix_server_address;
     io_uring_prep_accept(sqe, server->fd, address, &server->server_address_length, 0);
-    io_uring_sqe_set_data64(sqe, data);
-    transport_worker_add_event(worker, server->fd, data, TRANSPORT_TIMEOUT_INFINITY);
+    transport_worker_add_event(worker, sqe, server->fd, data, TRANSPORT_TIMEOUT_INFINITY, 0);
+}
+
+void transport_worker_send_ring_message(transport_worker_t* worker, transport_worker_t* target, uint32_t data, int32_t value, uint16_t event)
+{
+    struct io_uring_sqe* sqe = transport_worker_provide_sqe(worker);
+    uint64_t delivered = ((uint64_t)data << 32) | ((uint64_t)worker->id << 16) | ((uint64_t)event | (uint64_t)TRANSPORT_EVENT_MESSAGE);
+    uint64_t failed = ((uint64_t)data << 32) | ((uint64_t)target->id << 16) | ((uint64_t)event | (uint64_t)TRANSPORT_EVENT_MESSAGE | (uint64_t)TRANSPORT_EVENT_WRITE);
+    io_uring_prep_msg_ring(sqe, target->ring->ring_fd, (uint32_t)value, delivered, 0);
+    io_uring_sqe_set_data64(sqe, failed);
+    sqe->flags |= IOSQE_CQE_SKIP_SUCCESS;
+    transport_trace_record(&worker->trace_ring, TRANSPORT_TRACE_SUBMIT, transport_worker_monotonic_nanos(), failed, value);
+}
+
+void transport_worker_wait(transport_worker_t* worker, uint32_t fd, uint16_t buffer_id, uint32_t* address, uint32_t value, int64_t timeout, uint16_t event)
+{
+    struct io_uring_sqe* sqe = transport_worker_provide_sqe(worker);
+    uint64_t data = (((uint64_t)(fd) << 32) | (uint64_t)(buffer_id) << 16) | ((uint64_t)event);
+    io_uring_prep_futex_wait(sqe, address, value, FUTEX_BITSET_MATCH_ANY, FUTEX2_SIZE_U32, 0);
+    transport_worker_add_event(worker, sqe, fd, data, timeout, 0);
 }
 
 void transport_worker_cancel_by_fd(transport_worker_t* worker, int fd)
 {
-    mh_int_t index;
-    mh_int_t to_delete[worker->events->size];
-    int to_delete_count = 0;
-    mh_foreach(worker->events, index)
+    int canceled = 0;
+    for (uint32_t index = 0; index < worker->slots_capacity; index++)
     {
-        struct mh_events_node_t* node = mh_events_node(worker->events, index);
-        if (node->fd == fd)
+        transport_worker_slot_t* slot = &worker->slots[index];
+        if (slot->state == TRANSPORT_WORKER_SLOT_ACTIVE && slot->fd == fd)
         {
-            struct io_uring* ring = worker->ring;
-            struct io_uring_sqe* sqe = transport_provide_sqe(ring);
-            io_uring_prep_cancel(sqe, (void*)node->data, IORING_ASYNC_CANCEL_ALL);
+            struct io_uring_sqe* sqe = transport_worker_provide_sqe(worker);
+            io_uring_prep_cancel64(sqe, transport_worker_slot_data(index, slot->generation, slot->data), IORING_ASYNC_CANCEL_ALL);
             sqe->flags |= IOSQE_CQE_SKIP_SUCCESS;
-            to_delete[to_delete_count++] = index;
+            transport_trace_record(&worker->trace_ring, TRANSPORT_TRACE_CANCEL, transport_worker_monotonic_nanos(), transport_worker_trace_data(slot), -ECANCELED);
+            slot->state = TRANSPORT_WORKER_SLOT_CANCELED;
+            canceled++;
         }
     }
-    for (int index = 0; index < to_delete_count; index++)
-    {
-        mh_events_del(worker->events, to_delete[index], 0);
-    }
+    worker->metrics->cancellations += canceled;
+    worker->metrics->submits++;
     io_uring_submit(worker->ring);
 }
 
@@ -291,48 +718,144 @@ int transport_worker_peek(transport_worker_t* worker)
         .tv_nsec = worker->cqe_wait_timeout_millis * 1e+6,
         .tv_sec = 0,
     };
+    transport_worker_metrics_t* metrics = worker->metrics;
+    metrics->submits++;
     io_uring_submit_and_wait_timeout(worker->ring, &worker->cqes[0], worker->cqe_wait_count, &timeout, 0);
-    return io_uring_peek_batch_cqe(worker->ring, &worker->cqes[0], worker->cqe_peek_count);
+    int count = io_uring_peek_batch_cqe(worker->ring, &worker->cqes[0], worker->cqe_peek_count);
+    if (!count)
+    {
+        metrics->empty_peeks++;
+        return 0;
+    }
+    struct timespec reap_time;
+    clock_gettime(CLOCK_REALTIME, &reap_time);
+    worker->reap_timestamp = reap_time.tv_sec * 1000000000ULL + reap_time.tv_nsec;
+    worker->reap_monotonic = transport_worker_monotonic_nanos();
+    metrics->cqes_reaped += count;
+    for (int index = 0; index < count; index++)
+    {
+        struct io_uring_cqe* cqe = worker->cqes[index];
+        uint64_t data = transport_worker_event_data(worker, cqe->user_data);
+        transport_trace_record(&worker->trace_ring, TRANSPORT_TRACE_COMPLETE, worker->reap_monotonic, data, cqe->res);
+        uint16_t event = (uint16_t)(data & 0xffff);
+        if (cqe->res <= 0 || event & (TRANSPORT_EVENT_MESSAGE | TRANSPORT_EVENT_SHARED))
+        {
+            continue;
+        }
+        if (event & TRANSPORT_EVENT_READ)
+        {
+            metrics->bytes_read += cqe->res;
+            continue;
+        }
+        if (event & TRANSPORT_EVENT_WRITE)
+        {
+            metrics->bytes_written += cqe->res;
+            continue;
+        }
+        if (event & TRANSPORT_EVENT_RECEIVE_MESSAGE)
+        {
+            metrics->bytes_received += cqe->res;
+            continue;
+        }
+        if (event & TRANSPORT_EVENT_SEND_MESSAGE)
+        {
+            metrics->bytes_sent += cqe->res;
+        }
+    }
+    return count;
 }
 
 void transport_worker_check_event_timeouts(transport_worker_t* worker)
 {
-    mh_int_t index;
-    mh_int_t to_delete[worker->events->size];
-    int to_delete_count = 0;
-    mh_foreach(worker->events, index)
+    int timed_out = 0;
+    time_t current_time = time(NULL);
+    for (uint32_t index = 0; index < worker->slots_capacity; index++)
     {
-        struct mh_events_node_t* node = mh_events_node(worker->events, index);
-        int64_t timeout = node->timeout;
-        if (timeout == TRANSPORT_TIMEOUT_INFINITY)
+        transport_worker_slot_t* slot = &worker->slots[index];
+        if (slot->state != TRANSPORT_WORKER_SLOT_ACTIVE || slot->timeout == TRANSPORT_TIMEOUT_INFINITY)
         {
             continue;
         }
-        uint64_t timestamp = node->timestamp;
-        uint64_t data = node->data;
-        time_t current_time = time(NULL);
-        if (current_time - timestamp > timeout)
+        if (current_time - slot->timestamp > slot->timeout)
         {
-            struct io_uring* ring = worker->ring;
-            struct io_uring_sqe* sqe = transport_provide_sqe(ring);
-            io_uring_prep_cancel(sqe, (void*)data, IORING_ASYNC_CANCEL_ALL);
+            struct io_uring_sqe* sqe = transport_worker_provide_sqe(worker);
+            io_uring_prep_cancel64(sqe, transport_worker_slot_data(index, slot->generation, slot->data), IORING_ASYNC_CANCEL_ALL);
             sqe->flags |= IOSQE_CQE_SKIP_SUCCESS;
-            to_delete[to_delete_count++] = index;
+            transport_trace_record(&worker->trace_ring, TRANSPORT_TRACE_CANCEL, transport_worker_monotonic_nanos(), transport_worker_trace_data(slot), -ETIMEDOUT);
+            slot->state = TRANSPORT_WORKER_SLOT_CANCELED;
+            timed_out++;
         }
     }
-    for (int index = 0; index < to_delete_count; index++)
+    worker->metrics->timeouts += timed_out;
+    worker->metrics->submits++;
+    io_uring_submit(worker->ring);
+}
+
+uint64_t transport_worker_remove_event(transport_worker_t* worker, uint64_t user_data)
+{
+    if (!(user_data & TRANSPORT_EVENT_SLOT))
     {
-        mh_events_del(worker->events, to_delete[index], 0);
+        return user_data;
     }
-    io_uring_submit(worker->ring);
+    transport_worker_slot_t* slot = transport_worker_find_slot(worker, user_data);
+    if (unlikely(!slot))
+    {
+        worker->metrics->unrouted_completions++;
+        return 0;
+    }
+    uint64_t data = slot->data;
+    transport_operation_t operation = transport_worker_operation(data);
+    if (likely(slot->state == TRANSPORT_WORKER_SLOT_ACTIVE && operation != TRANSPORT_OPERATIONS_COUNT))
+    {
+        uint64_t elapsed = worker->reap_monotonic > slot->started ? worker->reap_monotonic - slot->started : 0;
+        transport_histogram_record(&worker->latencies[operation], elapsed);
+    }
+    uint32_t index = (uint32_t)(slot - worker->slots);
+    slot->state = TRANSPORT_WORKER_SLOT_FREE;
+    slot->generation++;
+    slot->next = worker->slots_free;
+    worker->slots_free = index;
+    worker->slots_used--;
+    return data;
 }
 
-void transport_worker_remove_event(transport_worker_t* worker, uint64_t data)
+int32_t transport_worker_bind(transport_worker_t* worker, uint32_t fd, uint32_t handle)
 {
-    mh_int_t event;
-    if ((event = mh_events_find(worker->events, data, 0)) != mh_end(worker->events))
+    if (fd >= worker->handles_capacity)
     {
-        mh_events_del(worker->events, event, 0);
+        uint32_t capacity = worker->handles_capacity * 2 > fd ? worker->handles_capacity * 2 : fd + 1;
+        uint32_t* handles = realloc(worker->handles, sizeof(uint32_t) * capacity);
+        if (!handles)
+        {
+            return -ENOMEM;
+        }
+        memset(&handles[worker->handles_capacity], 0, sizeof(uint32_t) * (capacity - worker->handles_capacity));
+        worker->handles = handles;
+        worker->handles_capacity = capacity;
+    }
+    worker->handles[fd] = handle;
+    return 0;
+}
+
+bool transport_worker_unbind(transport_worker_t* worker, uint32_t fd, uint32_t handle)
+{
+    if (fd >= worker->handles_capacity || worker->handles[fd] != handle)
+    {
+        return false;
+    }
+    worker->handles[fd] = 0;
+    return true;
+}
+
+void transport_worker_snapshot_latencies(transport_worker_t* worker, transport_histogram_t* target, bool reset)
+{
+    memcpy(target, worker->latencies, sizeof(transport_histogram_t) * TRANSPORT_OPERATIONS_COUNT);
+    if (reset)
+    {
+        for (int operation = 0; operation < TRANSPORT_OPERATIONS_COUNT; operation++)
+        {
+            transport_histogram_reset(&worker->latencies[operation]);
+        }
     }
 }
 
@@ -342,21 +865,56 @@ struct sockaddr* transport_worker_get_datagram_address(transport_worker_t* worke
                                  : (struct sockaddr*)worker->unix_used_messages[buffer_id].msg_name;
 }
 
+uint16_t transport_worker_get_datagram_segment_size(transport_worker_t* worker, transport_socket_family_t socket_family, int buffer_id)
+{
+    struct msghdr* message = socket_family == INET ? &worker->inet_used_messages[buffer_id] : &worker->unix_used_messages[buffer_id];
+    for (struct cmsghdr* control = CMSG_FIRSTHDR(message); control != NULL; control = CMSG_NXTHDR(message, control))
+    {
+        if (control->cmsg_level == SOL_UDP && control->cmsg_type == UDP_GRO)
+        {
+            return (uint16_t)(*(int*)CMSG_DATA(control));
+        }
+    }
+    return 0;
+}
+
+uint64_t transport_worker_get_datagram_timestamp(transport_worker_t* worker, transport_socket_family_t socket_family, int buffer_id)
+{
+    struct msghdr* message = socket_family == INET ? &worker->inet_used_messages[buffer_id] : &worker->unix_used_messages[buffer_id];
+    for (struct cmsghdr* control = CMSG_FIRSTHDR(message); control != NULL; control = CMSG_NXTHDR(message, control))
+    {
+        if (control->cmsg_level == SOL_SOCKET && control->cmsg_type == SCM_TIMESTAMPING)
+        {
+            struct timespec* timestamps = (struct timespec*)CMSG_DATA(control);
+            struct timespec* timestamp = timestamps[2].tv_sec || timestamps[2].tv_nsec ? &timestamps[2] : &timestamps[0];
+            return timestamp->tv_sec * 1000000000ULL + timestamp->tv_nsec;
+        }
+    }
+    return 0;
+}
+
+size_t transport_worker_dump_trace(transport_worker_t* worker, transport_trace_entry_t* target, size_t capacity)
+{
+    return transport_trace_dump(&worker->trace_ring, target, capacity);
+}
+
 void transport_worker_destroy(transport_worker_t* worker)
 {
     io_uring_queue_exit(worker->ring);
     for (size_t index = 0; index < worker->buffers_count; index++)
     {
-        free(worker->buffers[index].iov_base);
-        free(worker->inet_used_messages[index].msg_name);
-        free(worker->unix_used_messages[index].msg_name);
+        transport_worker_free_buffer(worker, index);
     }
     transport_buffers_pool_destroy(&worker->free_buffers);
-    mh_events_delete(worker->events);
+    free(worker->slots);
+    free(worker->handles);
     free(worker->cqes);
     free(worker->buffers);
     free(worker->inet_used_messages);
     free(worker->unix_used_messages);
     free(worker->ring);
+    free(worker->metrics);
+    free(worker->latencies);
+    transport_trace_destroy(&worker->trace_ring);
     free(worker);
 }
\ No newline at end of file
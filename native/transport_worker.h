@@ -6,6 +6,8 @@
 #include "transport_buffers_pool.h"
 #include "transport_client.h"
 #include "transport_collections.h"
+#include "transport_histogram.h"
+#include "transport_trace.h"
 #include "transport_server.h"
 
 #if defined(__cplusplus)
@@ -15,6 +17,9 @@ extern "C"
     typedef struct transport_worker_configuration
     {
         uint16_t buffers_count;
+        uint16_t buffers_max_count;
+        double buffers_grow_occupancy;
+        double buffers_shrink_occupancy;
         uint32_t buffer_size;
         size_t ring_size;
         unsigned int ring_flags;
@@ -26,8 +31,51 @@ extern "C"
         uint32_t cqe_wait_count;
         uint32_t cqe_peek_count;
         bool trace;
+        uint32_t trace_capacity;
     } transport_worker_configuration_t;
 
+#define TRANSPORT_WORKER_METRICS_ALIGNMENT 64
+#define TRANSPORT_WORKER_BUFFERS_LIMIT 16384
+
+#define TRANSPORT_WORKER_SLOT_NONE UINT32_MAX
+#define TRANSPORT_WORKER_SLOT_INDEX_SHIFT 16
+#define TRANSPORT_WORKER_SLOT_GENERATION_SHIFT 48
+
+    typedef enum transport_worker_slot_state
+    {
+        TRANSPORT_WORKER_SLOT_FREE = 0,
+        TRANSPORT_WORKER_SLOT_ACTIVE,
+        TRANSPORT_WORKER_SLOT_CANCELED,
+    } transport_worker_slot_state_t;
+
+    typedef struct transport_worker_slot
+    {
+        uint64_t data;
+        int64_t timeout;
+        uint64_t timestamp;
+        uint64_t started;
+        int fd;
+        uint32_t next;
+        uint16_t generation;
+        uint8_t state;
+    } transport_worker_slot_t;
+
+    typedef struct transport_worker_metrics
+    {
+        uint64_t sqes_prepared;
+        uint64_t submits;
+        uint64_t cqes_reaped;
+        uint64_t empty_peeks;
+        uint64_t sq_full_waits;
+        uint64_t timeouts;
+        uint64_t cancellations;
+        uint64_t bytes_read;
+        uint64_t bytes_written;
+        uint64_t bytes_received;
+        uint64_t bytes_sent;
+        uint64_t unrouted_completions;
+    } __attribute__((aligned(TRANSPORT_WORKER_METRICS_ALIGNMENT))) transport_worker_metrics_t;
+
     typedef struct transport_worker
     {
         uint8_t id;
@@ -42,7 +90,11 @@ extern "C"
         uint64_t max_delay_micros;
         struct msghdr* inet_used_messages;
         struct msghdr* unix_used_messages;
-        struct mh_events_t* events;
+        transport_worker_slot_t* slots;
+        uint32_t slots_capacity;
+        uint32_t slots_free;
+        uint32_t slots_used;
+        bool slots_chain_failed;
         size_t ring_size;
         int ring_flags;
         struct io_uring_cqe** cqes;
@@ -50,6 +102,20 @@ extern "C"
         uint32_t cqe_wait_count;
         uint32_t cqe_peek_count;
         bool trace;
+        uint64_t reap_timestamp;
+        transport_worker_metrics_t* metrics;
+        uint64_t reap_monotonic;
+        transport_histogram_t* latencies;
+        struct transport_trace trace_ring;
+        bool ring_sockets;
+        bool ring_socket_options;
+        uint16_t buffers_initial_count;
+        uint16_t buffers_max_count;
+        double buffers_grow_occupancy;
+        double buffers_shrink_occupancy;
+        bool buffers_sparse;
+        uint32_t* handles;
+        uint32_t handles_capacity;
     } transport_worker_t;
 
     int transport_worker_initialize(transport_worker_t* worker,
@@ -59,17 +125,42 @@ extern "C"
     void transport_worker_write(transport_worker_t* worker,
                                 uint32_t fd,
                                 uint16_t buffer_id,
-                                uint32_t offset,
+                                uint64_t offset,
                                 int64_t timeout,
                                 uint16_t event,
                                 uint8_t sqe_flags);
     void transport_worker_read(transport_worker_t* worker,
                                uint32_t fd,
                                uint16_t buffer_id,
-                               uint32_t offset,
+                               uint64_t offset,
                                int64_t timeout,
                                uint16_t event,
                                uint8_t sqe_flags);
+    void transport_worker_sync(transport_worker_t* worker,
+                               uint32_t fd,
+                               uint16_t buffer_id,
+                               bool data_only,
+                               int64_t timeout,
+                               uint16_t event,
+                               uint8_t sqe_flags);
+    void transport_worker_allocate(transport_worker_t* worker,
+                                   uint32_t fd,
+                                   uint16_t buffer_id,
+                                   int mode,
+                                   uint64_t offset,
+                                   uint64_t length,
+                                   int64_t timeout,
+                                   uint16_t event,
+                                   uint8_t sqe_flags);
+    void transport_worker_advise(transport_worker_t* worker,
+                                 uint32_t fd,
+                                 uint16_t buffer_id,
+                                 void* address,
+                                 uint64_t length,
+                                 int advice,
+                                 int64_t timeout,
+                                 uint16_t event,
+                                 uint8_t sqe_flags);
     void transport_worker_send_message(transport_worker_t* worker,
                                        uint32_t fd,
                                        uint16_t buffer_id,
@@ -79,6 +170,16 @@ extern "C"
                                        int64_t timeout,
                                        uint16_t event,
                                        uint8_t sqe_flags);
+    void transport_worker_send_message_segmented(transport_worker_t* worker,
+                                                 uint32_t fd,
+                                                 uint16_t buffer_id,
+                                                 struct sockaddr* address,
+                                                 transport_socket_family_t socket_family,
+                                                 int message_flags,
+                                                 uint16_t segment_size,
+                                                 int64_t timeout,
+                                                 uint16_t event,
+                                                 uint8_t sqe_flags);
     void transport_worker_receive_message(transport_worker_t* worker,
                                           uint32_t fd,
                                           uint16_t buffer_id,
@@ -87,23 +188,38 @@ extern "C"
                                           int64_t timeout,
                                           uint16_t event,
                                           uint8_t sqe_flags);
+    void transport_worker_socket(transport_worker_t* worker, transport_client_t* client, uint32_t slot);
     void transport_worker_connect(transport_worker_t* worker, transport_client_t* client, int64_t timeout);
+    void transport_worker_connect_with_data(transport_worker_t* worker, transport_client_t* client, uint16_t buffer_id, int64_t timeout);
     void transport_worker_accept(transport_worker_t* worker, transport_server_t* server);
+    void transport_worker_send_ring_message(transport_worker_t* worker, transport_worker_t* target, uint32_t data, int32_t value, uint16_t event);
+    void transport_worker_wait(transport_worker_t* worker, uint32_t fd, uint16_t buffer_id, uint32_t* address, uint32_t value, int64_t timeout, uint16_t event);
 
     void transport_worker_cancel_by_fd(transport_worker_t* worker, int fd);
 
     void transport_worker_check_event_timeouts(transport_worker_t* worker);
-    void transport_worker_remove_event(transport_worker_t* worker, uint64_t data);
+    uint64_t transport_worker_remove_event(transport_worker_t* worker, uint64_t user_data);
+
+    int32_t transport_worker_bind(transport_worker_t* worker, uint32_t fd, uint32_t handle);
+    bool transport_worker_unbind(transport_worker_t* worker, uint32_t fd, uint32_t handle);
 
     int32_t transport_worker_get_buffer(transport_worker_t* worker);
     void transport_worker_release_buffer(transport_worker_t* worker, uint16_t buffer_id);
+    int32_t transport_worker_grow_buffers(transport_worker_t* worker, uint16_t count);
+    int32_t transport_worker_shrink_buffers(transport_worker_t* worker, uint16_t count);
     int32_t transport_worker_available_buffers(transport_worker_t* worker);
     int32_t transport_worker_used_buffers(transport_worker_t* worker);
 
     struct sockaddr* transport_worker_get_datagram_address(transport_worker_t* worker, transport_socket_family_t socket_family, int buffer_id);
+    uint16_t transport_worker_get_datagram_segment_size(transport_worker_t* worker, transport_socket_family_t socket_family, int buffer_id);
+    uint64_t transport_worker_get_datagram_timestamp(transport_worker_t* worker, transport_socket_family_t socket_family, int buffer_id);
 
     int transport_worker_peek(transport_worker_t* worker);
 
+    void transport_worker_snapshot_latencies(transport_worker_t* worker, transport_histogram_t* target, bool reset);
+
+    size_t transport_worker_dump_trace(transport_worker_t* worker, transport_trace_entry_t* target, size_t capacity);
+
     void transport_worker_destroy(transport_worker_t* worker);
 
 #if defined(__cplusplus)